@@ -0,0 +1,82 @@
+#pragma once
+#include "PluginProcessor.h"
+
+#include <juce_gui_basics/juce_gui_basics.h>
+
+#include <random>
+
+/**
+ * Helpers shared by the headless benchmark and check targets.
+ *
+ * Every target creates a ScopedJuceRuntime at the top of main(): the
+ * processor's parameter tree needs a message manager.
+ */
+namespace EnzoGainBench
+{
+    using ScopedJuceRuntime = juce::ScopedJuceInitialiser_GUI;
+
+    /** Sets a parameter in its own units (%, Hz, choice index),
+        notifying the host as an edit from the UI would. */
+    inline void setParameter(EnzoGainAudioProcessor& processor, const char* id, float value)
+    {
+        if (auto* parameter = processor.parameters.getParameter(id))
+            parameter->setValueNotifyingHost(parameter->convertTo0to1(value));
+    }
+
+    /** The continuous parameters a randomised state was given. */
+    struct ContinuousValues
+    {
+        float gain, pan, drive, lfoStrength, lfoFreq;
+    };
+
+    /** Gain, pan, drive and LFO strength / rate, uniform over their ranges
+        (gain from 20 %, so no instance is silent). */
+    inline ContinuousValues randomiseContinuous(EnzoGainAudioProcessor& processor, std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+        const ContinuousValues values { 0.2f + 1.3f * unit(rng),
+                                        -100.0f + 200.0f * unit(rng),
+                                        100.0f * unit(rng),
+                                        100.0f * unit(rng),
+                                        0.1f + 19.9f * unit(rng) };
+
+        setParameter(processor, "GAIN",         values.gain);
+        setParameter(processor, "PAN",          values.pan);
+        setParameter(processor, "SAT_DRIVE",    values.drive);
+        setParameter(processor, "LFO_STRENGTH", values.lfoStrength);
+        setParameter(processor, "LFO_FREQ",     values.lfoFreq);
+        return values;
+    }
+
+    /** How often a randomised state has each section switched on.  The
+        defaults make every switch and choice uniform. */
+    struct SwitchOdds
+    {
+        float saturation   = 0.5f;
+        float oversampling = 0.75f;   // any of 2x / 4x / 8x
+        float lfo          = 0.5f;
+    };
+
+    /** The section switches and choices: saturation on / mode / quality,
+        oversampling factor / filter, LFO on. */
+    inline void randomiseSwitches(EnzoGainAudioProcessor& processor, std::mt19937& rng, SwitchOdds odds = {})
+    {
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+        std::uniform_int_distribution<int> satMode(0, 4), quality(0, 3), factor(1, 3), filter(0, 1);
+
+        setParameter(processor, "SAT_ENABLED", unit(rng) < odds.saturation ? 1.0f : 0.0f);
+        setParameter(processor, "SAT_MODE",    (float) satMode(rng));
+        setParameter(processor, "SAT_QUALITY", (float) quality(rng));
+        setParameter(processor, "OS_FACTOR",   unit(rng) < odds.oversampling ? (float) factor(rng) : 0.0f);
+        setParameter(processor, "OS_FILTER",   (float) filter(rng));
+        setParameter(processor, "LFO_ENABLED", unit(rng) < odds.lfo ? 1.0f : 0.0f);
+    }
+
+    /** A whole random parameter state. */
+    inline ContinuousValues randomise(EnzoGainAudioProcessor& processor, std::mt19937& rng, SwitchOdds odds = {})
+    {
+        randomiseSwitches(processor, rng, odds);
+        return randomiseContinuous(processor, rng);
+    }
+}
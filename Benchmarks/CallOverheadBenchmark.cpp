@@ -0,0 +1,194 @@
+/*
+ * Fixed per-call overhead of processBlock at small buffers.
+ *
+ * Built twice from this file: EnzoGain_CallOverheadBenchmark against the
+ * current processor, and EnzoGain_CallOverheadBaseline against the
+ * processor of ENZOGAIN_CALL_OVERHEAD_BASELINE (by default the revision
+ * before the per-call cost work), checked out of git into the build tree
+ * at configure time.  Run both; the block16 rows are the before / after.
+ *
+ *   block16_*    a whole processBlock call at 16 samples, plus the
+ *                overhead left after subtracting 16 × the per-sample cost
+ *                measured at 4096 samples
+ *
+ * Current processor only:
+ *
+ *   params_*     the per-block parameter read on its own — the eleven
+ *                string-keyed getRawParameterValue lookups processBlock
+ *                used to do against the cached-atomic ParameterSnapshot
+ *                it does now
+ *
+ *   analyser_tap*
+ *                one snapshot-ring write of a stereo block: all an enabled
+ *                analyser tap adds to processBlock (the FFT runs on the
+ *                editor's analyser thread)
+ *
+ * Output is CSV on stdout:  processor,measurement,ns_per_call,overhead_ns_per_call
+ */
+
+#include "BenchmarkSupport.h"
+
+#ifndef ENZOGAIN_CALL_OVERHEAD_BASELINE
+ #define ENZOGAIN_CALL_OVERHEAD_BASELINE 0
+#endif
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+
+namespace
+{
+    constexpr int numRepeats = 7;
+    constexpr double sampleRate = 48000.0;
+
+    const char* const processorName = ENZOGAIN_CALL_OVERHEAD_BASELINE ? "baseline" : "current";
+
+   #if ! ENZOGAIN_CALL_OVERHEAD_BASELINE
+    volatile float sink = 0.0f;   // keeps the measured reads alive
+
+    const char* const parameterIDs[] =
+    {
+        "GAIN", "PAN", "SAT_DRIVE", "LFO_STRENGTH", "LFO_FREQ",
+        "LFO_ENABLED", "SAT_MODE", "SAT_ENABLED", "SAT_QUALITY", "OS_FACTOR", "OS_FILTER"
+    };
+   #endif
+
+    /** Best-of-numRepeats mean time of one call, in ns. */
+    double timePerCall(int numCalls, const std::function<void()>& call)
+    {
+        double best = 1.0e300;
+
+        for (int repeat = 0; repeat < numRepeats; ++repeat)
+        {
+            const auto t0 = std::chrono::steady_clock::now();
+
+            for (int i = 0; i < numCalls; ++i)
+                call();
+
+            const auto t1 = std::chrono::steady_clock::now();
+            best = juce::jmin(best, std::chrono::duration<double, std::nano>(t1 - t0).count() / numCalls);
+        }
+
+        return best;
+    }
+
+    using EnzoGainBench::setParameter;
+
+    /** ns per processBlock call at blockSize samples, after a settling warm-up. */
+    double timeBlock(const std::function<void(EnzoGainAudioProcessor&)>& configure, int blockSize)
+    {
+        EnzoGainAudioProcessor processor;
+        configure(processor);
+        processor.setRateAndBufferSizeDetails(sampleRate, blockSize);
+        processor.prepareToPlay(sampleRate, blockSize);
+
+        juce::AudioBuffer<float> source(2, blockSize), buffer(2, blockSize);
+        juce::MidiBuffer midi;
+
+        for (int channel = 0; channel < 2; ++channel)
+            for (int i = 0; i < blockSize; ++i)
+                source.setSample(channel, i, 0.25f * (float) std::sin(0.01 * i));
+
+        // Refill every call: processing in place would otherwise decay the
+        // signal towards denormals and time those instead
+        auto call = [&]
+        {
+            for (int channel = 0; channel < 2; ++channel)
+                buffer.copyFrom(channel, 0, source, channel, 0, blockSize);
+
+            processor.processBlock(buffer, midi);
+        };
+
+        const int warmUp = (int) (0.1 * sampleRate) / blockSize + 1;   // smoothers settle within 50 ms
+        for (int i = 0; i < warmUp; ++i)
+            call();
+
+        return timePerCall(juce::jmax(200, (int) (2.0 * sampleRate) / blockSize), call);
+    }
+}
+
+int main()
+{
+    EnzoGainBench::ScopedJuceRuntime juceRuntime;
+
+    std::cout << "processor,measurement,ns_per_call,overhead_ns_per_call\n";
+
+   #if ! ENZOGAIN_CALL_OVERHEAD_BASELINE
+    // ── Parameter read ───────────────────────────────────────────────────
+    {
+        EnzoGainAudioProcessor processor;
+
+        const double lookup = timePerCall(200000, [&]
+        {
+            float sum = 0.0f;
+            for (auto* id : parameterIDs)
+                sum += processor.parameters.getRawParameterValue(id)->load();
+            sink = sum;
+        });
+
+        const double snapshot = timePerCall(200000, [&]
+        {
+            const auto params = processor.readParameters();
+            sink = params.automatable[0] + (float) params.satMode;
+        });
+
+        std::cout << processorName << ",params_string_lookup," << lookup << ",\n"
+                  << processorName << ",params_snapshot," << snapshot << ",\n";
+    }
+   #endif
+
+    // ── Whole calls at 16 samples ────────────────────────────────────────
+    const std::pair<const char*, std::function<void(EnzoGainAudioProcessor&)>> configs[] =
+    {
+        { "block16_settled", [] (EnzoGainAudioProcessor&) {} },
+
+        { "block16_tape", [] (EnzoGainAudioProcessor& p)
+          {
+              setParameter(p, "SAT_ENABLED", 1.0f);
+              setParameter(p, "SAT_MODE", 1.0f);
+              setParameter(p, "SAT_DRIVE", 60.0f);
+          } },
+
+        { "block16_tape_lfo_pan", [] (EnzoGainAudioProcessor& p)
+          {
+              setParameter(p, "SAT_ENABLED", 1.0f);
+              setParameter(p, "SAT_MODE", 1.0f);
+              setParameter(p, "SAT_DRIVE", 60.0f);
+              setParameter(p, "LFO_ENABLED", 1.0f);
+              setParameter(p, "LFO_STRENGTH", 50.0f);
+              setParameter(p, "PAN", 40.0f);
+          } },
+    };
+
+    for (const auto& [name, configure] : configs)
+    {
+        const double small = timeBlock(configure, 16);
+        const double large = timeBlock(configure, 4096);
+        const double overhead = small - 16.0 * large / 4096.0;
+
+        std::cout << processorName << ',' << name << ',' << small << ',' << overhead << '\n';
+    }
+
+   #if ! ENZOGAIN_CALL_OVERHEAD_BASELINE
+    // ── Analyser snapshot tap ────────────────────────────────────────────
+    //   Everything a tap adds to processBlock: one stereo mix into the ring
+    for (const int blockSize : { 16, 64, 1024 })
+    {
+        EnzoGainDSP::SnapshotRing ring;
+        juce::AudioBuffer<float> buffer(2, blockSize);
+
+        for (int channel = 0; channel < 2; ++channel)
+            for (int i = 0; i < blockSize; ++i)
+                buffer.setSample(channel, i, 0.25f * (float) std::sin(0.01 * i));
+
+        const double write = timePerCall(juce::jmax(2000, 4000000 / blockSize), [&]
+        {
+            ring.write(buffer.getArrayOfReadPointers(), 2, blockSize);
+        });
+
+        std::cout << processorName << ",analyser_tap" << blockSize << ',' << write << ",\n";
+    }
+   #endif
+
+    return 0;
+}
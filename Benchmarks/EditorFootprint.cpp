@@ -0,0 +1,323 @@
+/*
+ * Editor footprint: memory and open time of the WebView and native editors.
+ *
+ * Creates N processors, then for each editor mode opens one editor per
+ * processor in its own window and waits until each has painted its first
+ * frame.  Reports, per mode:
+ *
+ *   open_ms        createEditor() to first painted frame, mean and worst
+ *                  (the editor's own measurement: for the WebView editor
+ *                  that includes loading and laying out the page)
+ *   mb_per_editor  memory added by the open editors / N
+ *   mb_after_close memory still held once they are closed again / N
+ *
+ * Memory is the proportional set size of this process and every process
+ * it spawned (the WebView's renderer and network processes on Linux),
+ * from /proc; resident size of this process alone elsewhere, which misses
+ * out-of-process browser engines.
+ *
+ * A GUI app, since the WebView needs a running message loop (and, on
+ * Linux, its child-process entry point).  Needs a display.
+ *
+ * Options:
+ *   --editors <n>  (8)    --mode web|native|both  (both)    --json
+ */
+
+#include "PluginProcessor.h"
+#include "EditorHost.h"
+
+#include <juce_gui_basics/juce_gui_basics.h>
+
+#include <fstream>
+#include <iostream>
+#include <map>
+
+#if JUCE_LINUX
+ #include <unistd.h>
+#elif JUCE_MAC
+ #include <mach/mach.h>
+#endif
+
+namespace
+{
+    using EditorMode = EnzoGainAudioProcessor::EditorMode;
+
+    constexpr int openTimeoutMs = 20000;
+    constexpr int settleMs      = 1000;
+
+   #if JUCE_LINUX
+    /** "Key:   1234 kB" from a /proc status-style file, in bytes; -1 if absent. */
+    double readProcKilobytes(const juce::String& path, const juce::String& key)
+    {
+        std::ifstream file(path.toStdString());
+        std::string line;
+
+        while (std::getline(file, line))
+        {
+            const juce::String text(line);
+
+            if (text.startsWith(key + ":"))
+                return text.fromFirstOccurrenceOf(":", false, false).trim().getDoubleValue() * 1024.0;
+        }
+
+        return -1.0;
+    }
+
+    /** This process and all its descendants, from the parent pid in /proc/<pid>/stat. */
+    juce::Array<int> getProcessTree()
+    {
+        std::multimap<int, int> children;
+
+        for (const auto& entry : juce::RangedDirectoryIterator(juce::File("/proc"), false, "*",
+                                                               juce::File::findDirectories))
+        {
+            const int pid = entry.getFile().getFileName().getIntValue();
+
+            if (pid <= 0)
+                continue;
+
+            // "pid (comm) state ppid ...": comm may hold spaces, so parse after the last ')'
+            const auto stat = entry.getFile().getChildFile("stat").loadFileAsString();
+            const auto fields = juce::StringArray::fromTokens(stat.fromLastOccurrenceOf(")", false, false), true);
+
+            if (fields.size() > 1)
+                children.emplace(fields[1].getIntValue(), pid);
+        }
+
+        juce::Array<int> tree { (int) getpid() };
+
+        for (int i = 0; i < tree.size(); ++i)
+        {
+            const auto range = children.equal_range(tree[i]);
+
+            for (auto it = range.first; it != range.second; ++it)
+                tree.add(it->second);
+        }
+
+        return tree;
+    }
+   #endif
+
+    /** Bytes attributable to this process tree; -1 where unsupported. */
+    double measureMemory()
+    {
+       #if JUCE_LINUX
+        double total = 0.0;
+
+        for (const int pid : getProcessTree())
+        {
+            const juce::String proc = "/proc/" + juce::String(pid) + "/";
+            double bytes = readProcKilobytes(proc + "smaps_rollup", "Pss");
+
+            if (bytes < 0.0)
+                bytes = readProcKilobytes(proc + "status", "VmRSS");
+
+            total += juce::jmax(0.0, bytes);
+        }
+
+        return total;
+       #elif JUCE_MAC
+        task_vm_info_data_t info {};
+        mach_msg_type_number_t count = TASK_VM_INFO_COUNT;
+
+        if (task_info(mach_task_self(), TASK_VM_INFO, (task_info_t) &info, &count) != KERN_SUCCESS)
+            return -1.0;
+
+        return (double) info.phys_footprint;
+       #else
+        return -1.0;
+       #endif
+    }
+
+    void pumpMessages(int milliseconds)
+    {
+        juce::MessageManager::getInstance()->runDispatchLoopUntil(milliseconds);
+    }
+
+    struct ModeResult
+    {
+        EditorMode mode;
+        int numEditors = 0, numTimedOut = 0;
+        double meanOpenMs = 0.0, worstOpenMs = 0.0;
+        double bytesPerEditor = -1.0, bytesAfterClose = -1.0;
+    };
+
+    ModeResult measureMode(EditorMode mode, int numEditors)
+    {
+        ModeResult result;
+        result.mode = mode;
+        result.numEditors = numEditors;
+
+        std::vector<std::unique_ptr<EnzoGainAudioProcessor>> processors;
+
+        for (int i = 0; i < numEditors; ++i)
+        {
+            processors.push_back(std::make_unique<EnzoGainAudioProcessor>());
+            processors.back()->setEditorMode(mode);
+        }
+
+        pumpMessages(settleMs);
+        const double before = measureMemory();
+
+        // ── Open ─────────────────────────────────────────────────────
+        std::vector<std::unique_ptr<juce::DocumentWindow>> windows;
+        std::vector<EnzoGainEditorHost*> editors;
+
+        for (auto& processor : processors)
+        {
+            auto* editor = dynamic_cast<EnzoGainEditorHost*>(processor->createEditorIfNeeded());
+            jassert(editor != nullptr);
+
+            auto window = std::make_unique<juce::DocumentWindow>("EnzoGain", juce::Colours::black,
+                                                                 juce::DocumentWindow::closeButton);
+            window->setUsingNativeTitleBar(true);
+            window->setContentNonOwned(editor, true);
+            window->setTopLeftPosition(40 + 24 * (int) windows.size(), 40 + 24 * (int) windows.size());
+            window->setVisible(true);
+
+            // One at a time, so each open time is that editor's alone
+            const double deadline = juce::Time::getMillisecondCounterHiRes() + openTimeoutMs;
+
+            while (editor->getOpenToFirstPaintMs() <= 0.0 && juce::Time::getMillisecondCounterHiRes() < deadline)
+                pumpMessages(1);
+
+            const double openMs = editor->getOpenToFirstPaintMs();
+
+            if (openMs <= 0.0)
+                ++result.numTimedOut;
+
+            result.meanOpenMs += openMs;
+            result.worstOpenMs = juce::jmax(result.worstOpenMs, openMs);
+
+            windows.push_back(std::move(window));
+            editors.push_back(editor);
+        }
+
+        result.meanOpenMs /= juce::jmax(1, numEditors - result.numTimedOut);
+
+        pumpMessages(settleMs);
+        const double open = measureMemory();
+
+        // ── Close ────────────────────────────────────────────────────
+        for (size_t i = 0; i < windows.size(); ++i)
+        {
+            windows[i]->clearContentComponent();
+            windows[i].reset();
+            delete editors[i];
+        }
+
+        pumpMessages(settleMs);
+        const double closed = measureMemory();
+
+        if (before >= 0.0)
+        {
+            result.bytesPerEditor  = (open - before) / numEditors;
+            result.bytesAfterClose = (closed - before) / numEditors;
+        }
+
+        return result;
+    }
+
+    const char* getModeName(EditorMode mode)
+    {
+        return mode == EditorMode::native ? "native" : "web";
+    }
+
+    void report(const std::vector<ModeResult>& results, bool json)
+    {
+        constexpr double mb = 1.0 / (1024.0 * 1024.0);
+
+        if (json)
+        {
+            std::cout << "[";
+
+            for (size_t i = 0; i < results.size(); ++i)
+            {
+                const auto& r = results[i];
+                std::cout << (i > 0 ? ", " : " ") << "{ \"mode\": \"" << getModeName(r.mode) << "\""
+                          << ", \"editors\": " << r.numEditors << ", \"timed_out\": " << r.numTimedOut
+                          << ", \"open_ms_mean\": " << r.meanOpenMs << ", \"open_ms_worst\": " << r.worstOpenMs
+                          << ", \"mb_per_editor\": " << r.bytesPerEditor * mb
+                          << ", \"mb_after_close\": " << r.bytesAfterClose * mb << " }";
+            }
+
+            std::cout << " ]\n";
+            return;
+        }
+
+        for (const auto& r : results)
+        {
+            std::cout << getModeName(r.mode) << " editor\n"
+                      << "  editors          " << r.numEditors << '\n'
+                      << "  open_ms          " << r.meanOpenMs << " mean, " << r.worstOpenMs << " worst\n";
+
+            if (r.numTimedOut > 0)
+                std::cout << "  timed_out        " << r.numTimedOut << '\n';
+
+            if (r.bytesPerEditor < 0.0 && r.bytesAfterClose < 0.0)
+                std::cout << "  mb_per_editor    n/a on this platform\n";
+            else
+                std::cout << "  mb_per_editor    " << r.bytesPerEditor * mb << '\n'
+                          << "  mb_after_close   " << r.bytesAfterClose * mb << '\n';
+        }
+    }
+}
+
+//==============================================================================
+
+class EditorFootprintApplication : public juce::JUCEApplication
+{
+public:
+    const juce::String getApplicationName() override    { return "EnzoGainEditorFootprint"; }
+    const juce::String getApplicationVersion() override { return "1.0"; }
+    bool moreThanOneInstanceAllowed() override          { return true; }
+
+    void initialise(const juce::String&) override
+    {
+        // Measure from the first message loop iteration, once the app is up
+        juce::MessageManager::callAsync([this] { run(); });
+    }
+
+    void shutdown() override {}
+
+private:
+    void run()
+    {
+        int numEditors = 8;
+        juce::String modes = "both";
+        bool json = false;
+
+        const auto args = getCommandLineParameterArray();
+
+        for (int i = 0; i < args.size(); ++i)
+        {
+            const bool hasValue = i + 1 < args.size();
+
+            if (args[i] == "--json")                        json       = true;
+            else if (args[i] == "--editors" && hasValue)    numEditors = juce::jlimit(1, 256, args[++i].getIntValue());
+            else if (args[i] == "--mode" && hasValue
+                     && juce::StringArray { "web", "native", "both" }.contains(args[i + 1]))
+                modes = args[++i];
+            else
+            {
+                std::cerr << "usage: EnzoGainEditorFootprint [--editors n] [--mode web|native|both] [--json]\n";
+                setApplicationReturnValue(1);
+                quit();
+                return;
+            }
+        }
+
+        std::vector<ModeResult> results;
+
+        if (modes != "web")
+            results.push_back(measureMode(EditorMode::native, numEditors));
+
+        if (modes != "native")
+            results.push_back(measureMode(EditorMode::web, numEditors));
+
+        report(results, json);
+        quit();
+    }
+};
+
+START_JUCE_APPLICATION(EditorFootprintApplication)
@@ -0,0 +1,198 @@
+/*
+ * Headless processBlock benchmark.
+ *
+ * Builds EnzoGainAudioProcessor without its editor and drives
+ * prepareToPlay / processBlock directly, sweeping
+ *
+ *   block size    16 … 4096
+ *   sample rate   44.1 k … 192 k
+ *   channels      1, 2
+ *   SAT_MODE      Off, Tape, Tube, Digital, Fold
+ *   LFO           off / on (50 % at 3 Hz)
+ *   PAN           centre / 60 % right
+ *
+ * Every configuration is warmed up until the smoothers have settled, then
+ * timed block by block.  Output is one row per configuration:
+ *
+ *   block_size,sample_rate,channels,sat_mode,lfo,pan,ns_per_sample,realtime_factor,p99_block_us
+ *
+ * ns_per_sample is per sample frame (all channels together),
+ * realtime_factor is audio time / processing time, and p99_block_us
+ * is the 99th-percentile wall time of a single processBlock call.
+ *
+ * Options:
+ *   --json         JSON array instead of CSV
+ *   --quick        block sizes 64/512/4096, 48 k and 96 k only
+ *   --seconds <s>  audio rendered per configuration (default 1)
+ */
+
+#include "BenchmarkSupport.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <numeric>
+#include <random>
+
+namespace
+{
+    struct Config
+    {
+        int    blockSize;
+        double sampleRate;
+        int    numChannels;
+        int    satMode;
+        bool   lfoOn;
+        float  pan;
+    };
+
+    struct Result
+    {
+        double nsPerSample;
+        double realtimeFactor;
+        double p99BlockMicros;
+    };
+
+    const char* satModeNames[] = { "Off", "Tape", "Tube", "Digital", "Fold" };
+
+    using EnzoGainBench::setParameter;
+
+    Result run(const Config& config, double secondsPerConfig)
+    {
+        EnzoGainAudioProcessor processor;
+
+        setParameter(processor, "GAIN",         0.8f);
+        setParameter(processor, "PAN",          config.pan);
+        setParameter(processor, "SAT_ENABLED",  config.satMode > 0 ? 1.0f : 0.0f);
+        setParameter(processor, "SAT_MODE",     (float) config.satMode);
+        setParameter(processor, "SAT_DRIVE",    60.0f);
+        setParameter(processor, "LFO_ENABLED",  config.lfoOn ? 1.0f : 0.0f);
+        setParameter(processor, "LFO_STRENGTH", 50.0f);
+        setParameter(processor, "LFO_FREQ",     3.0f);
+
+        processor.setRateAndBufferSizeDetails(config.sampleRate, config.blockSize);
+        processor.prepareToPlay(config.sampleRate, config.blockSize);
+
+        // Fixed noise source, re-copied before every block so the signal
+        // level never drifts with gain or saturation
+        juce::AudioBuffer<float> source(config.numChannels, config.blockSize);
+        juce::AudioBuffer<float> buffer(config.numChannels, config.blockSize);
+        juce::MidiBuffer midi;
+
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<float> noise(-0.5f, 0.5f);
+
+        for (int channel = 0; channel < config.numChannels; ++channel)
+            for (int i = 0; i < config.blockSize; ++i)
+                source.setSample(channel, i, noise(rng));
+
+        auto renderBlock = [&]
+        {
+            for (int channel = 0; channel < config.numChannels; ++channel)
+                buffer.copyFrom(channel, 0, source, channel, 0, config.blockSize);
+
+            const auto t0 = std::chrono::steady_clock::now();
+            processor.processBlock(buffer, midi);
+            const auto t1 = std::chrono::steady_clock::now();
+
+            return std::chrono::duration<double, std::nano>(t1 - t0).count();
+        };
+
+        // Warm-up: 100 ms covers every smoother ramp (≤ 50 ms) and the caches
+        const int warmUpBlocks = juce::jmax(8, (int) (0.1 * config.sampleRate) / config.blockSize);
+
+        for (int block = 0; block < warmUpBlocks; ++block)
+            renderBlock();
+
+        const int numBlocks = juce::jmax(32, (int) (secondsPerConfig * config.sampleRate) / config.blockSize);
+        std::vector<double> blockNs((size_t) numBlocks);
+
+        for (auto& ns : blockNs)
+            ns = renderBlock();
+
+        const double totalNs = std::accumulate(blockNs.begin(), blockNs.end(), 0.0);
+        const double numFrames = (double) numBlocks * config.blockSize;
+
+        const auto p99 = blockNs.begin() + (std::ptrdiff_t) ((blockNs.size() - 1) * 99 / 100);
+        std::nth_element(blockNs.begin(), p99, blockNs.end());
+
+        Result result;
+        result.nsPerSample    = totalNs / numFrames;
+        result.realtimeFactor = (numFrames / config.sampleRate) * 1.0e9 / totalNs;
+        result.p99BlockMicros = *p99 * 1.0e-3;
+        return result;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    EnzoGainBench::ScopedJuceRuntime juceRuntime;
+
+    bool json = false, quick = false;
+    double secondsPerConfig = 1.0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const juce::String arg(argv[i]);
+
+        if (arg == "--json")                         json = true;
+        else if (arg == "--quick")                   quick = true;
+        else if (arg == "--seconds" && i + 1 < argc) secondsPerConfig = juce::jmax(0.01, std::atof(argv[++i]));
+        else
+        {
+            std::cerr << "usage: " << argv[0] << " [--json] [--quick] [--seconds <s>]\n";
+            return 1;
+        }
+    }
+
+    const std::vector<int> blockSizes = quick ? std::vector<int> { 64, 512, 4096 }
+                                              : std::vector<int> { 16, 32, 64, 128, 256, 512, 1024, 2048, 4096 };
+    const std::vector<double> sampleRates = quick ? std::vector<double> { 48000.0, 96000.0 }
+                                                  : std::vector<double> { 44100.0, 48000.0, 88200.0, 96000.0, 176400.0, 192000.0 };
+
+    if (json)
+        std::cout << "[\n";
+    else
+        std::cout << "block_size,sample_rate,channels,sat_mode,lfo,pan,ns_per_sample,realtime_factor,p99_block_us\n";
+
+    bool first = true;
+
+    for (int blockSize : blockSizes)
+    for (double sampleRate : sampleRates)
+    for (int numChannels : { 1, 2 })
+    for (int satMode = 0; satMode <= 4; ++satMode)
+    for (bool lfoOn : { false, true })
+    for (float pan : { 0.0f, 60.0f })
+    {
+        const Config config { blockSize, sampleRate, numChannels, satMode, lfoOn, pan };
+        const auto result = run(config, secondsPerConfig);
+
+        if (json)
+        {
+            std::cout << (first ? "" : ",\n")
+                      << "  { \"block_size\": " << blockSize
+                      << ", \"sample_rate\": " << sampleRate
+                      << ", \"channels\": " << numChannels
+                      << ", \"sat_mode\": \"" << satModeNames[satMode] << '"'
+                      << ", \"lfo\": " << (lfoOn ? "true" : "false")
+                      << ", \"pan\": " << pan
+                      << ", \"ns_per_sample\": " << result.nsPerSample
+                      << ", \"realtime_factor\": " << result.realtimeFactor
+                      << ", \"p99_block_us\": " << result.p99BlockMicros << " }";
+        }
+        else
+        {
+            std::cout << blockSize << ',' << sampleRate << ',' << numChannels << ','
+                      << satModeNames[satMode] << ',' << (lfoOn ? 1 : 0) << ',' << pan << ','
+                      << result.nsPerSample << ',' << result.realtimeFactor << ','
+                      << result.p99BlockMicros << '\n';
+        }
+
+        first = false;
+    }
+
+    if (json)
+        std::cout << "\n]\n";
+
+    return 0;
+}
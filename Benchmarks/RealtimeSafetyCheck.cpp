@@ -0,0 +1,681 @@
+/*
+ * Real-time-safety check for the audio thread.
+ *
+ * Runs EnzoGainAudioProcessor headless with the allocator, lock
+ * primitives and the usual blocking calls interposed.  Any of them made
+ * by a thread while it is inside the audio callback (the host's parameter
+ * delivery, then processBlock) is a violation: the first one from each
+ * call site is reported on stderr with a backtrace (raw symbols; pipe
+ * through c++filt), every one is counted, and the exit status is non-zero
+ * if there were any — so the tool can gate CI.
+ *
+ * Coverage, for mono, stereo, 5.1 and third-order ambisonics, in float
+ * and double precision, at a 16-sample / 44.1 kHz and a 512-sample /
+ * 96 kHz prepareToPlay:
+ *
+ *   - every LFO_ENABLED × SAT_ENABLED × SAT_MODE × SAT_QUALITY ×
+ *     OS_FACTOR × OS_FILTER combination (640), stepped through in turn so
+ *     each switch between neighbours happens inside processBlock, with
+ *     random gain / pan / drive / LFO values on every block and
+ *     timestamped changes scheduled from inside the audio callback
+ *   - full and partial blocks
+ *   - setStateInformation of every sixteenth state visited, each followed
+ *     by more blocks
+ *   - editors: closed, the WebView editor, the native editor, in turn.  The
+ *     WebView editor cannot exist headless, so the tool does to the
+ *     processor what it does: metering and analyser taps on while open,
+ *     meter FIFO drained per tick.  The native editor is the real one,
+ *     created and destroyed on the message thread
+ *
+ * Callbacks run on an audio thread of their own, never the message thread,
+ * and the parameter changes go in the checked region with them: the VST3
+ * and AU wrappers set parameters and notify their listeners (the editors'
+ * among them) from inside the audio callback.  The locks the wrapper's
+ * delivery itself takes — each parameter's and the processor's listener
+ * lock, learned per processor beforehand — are counted apart, as the
+ * plugin cannot avoid them; anything the listeners do is checked.
+ * prepareToPlay and setStateInformation run on the message thread, outside
+ * the checked region, as in a host.  A no-op AudioProcessorListener is
+ * attached throughout, as the plugin wrapper attaches one, so host
+ * notifications from processBlock take the locks they would take in a host.
+ *
+ * Hooks: on Linux (glibc) malloc / calloc / realloc / free / memalign,
+ * pthread mutex and rwlock locks, condition-variable and semaphore waits,
+ * sleeps and file I/O; elsewhere global operator new / delete only.
+ *
+ * Options:
+ *   --quick            stereo, float, one prepareToPlay
+ *   --max-reports <n>  backtraces to print (16)
+ */
+
+#if defined(__linux__)
+ #undef _FORTIFY_SOURCE        // the hooks replace read / write, which fortify inlines
+ #define ENZOGAIN_HOOK_LIBC 1
+#else
+ #define ENZOGAIN_HOOK_LIBC 0
+#endif
+
+#include "BenchmarkSupport.h"
+
+#include "NativeEditor.h"
+
+#include <cerrno>
+#include <condition_variable>
+#include <cstdarg>
+#include <iostream>
+#include <random>
+#include <set>
+#include <thread>
+
+#if ENZOGAIN_HOOK_LIBC
+ #include <dlfcn.h>
+ #include <fcntl.h>
+ #include <pthread.h>
+ #include <semaphore.h>
+ #include <unistd.h>
+#endif
+
+//==============================================================================
+// Checked region and reporting
+//==============================================================================
+
+namespace RealtimeGuard
+{
+    thread_local int depth = 0;              // > 0 while this thread is inside the audio callback
+    thread_local bool reporting = false;     // the report itself may allocate and lock
+
+    std::atomic<int> numViolations { 0 };
+    int maxReports = 16;
+    std::string stage;                       // what the driver is doing, for the reports
+    std::set<juce::String> sites;
+
+    struct ScopedAudioThread
+    {
+        ScopedAudioThread() noexcept  { ++depth; }
+        ~ScopedAudioThread() noexcept { --depth; }
+    };
+
+    // The wrapper's own locks for delivering a parameter change (see the
+    // header): recorded while learning, exempt while delivering
+    thread_local bool learningHostLocks = false;
+    thread_local bool deliveringHostChange = false;
+    std::array<const void*, 64> hostLocks {};
+    std::atomic<int> numHostLocks { 0 };
+    std::atomic<int> numHostLockCalls { 0 };
+
+    struct ScopedHostChange
+    {
+        ScopedHostChange() noexcept  { deliveringHostChange = true; }
+        ~ScopedHostChange() noexcept { deliveringHostChange = false; }
+    };
+
+    bool isHostLock(const void* lock) noexcept
+    {
+        const auto* begin = hostLocks.data();
+        const auto* end = begin + numHostLocks.load(std::memory_order_relaxed);
+        const bool known = std::find(begin, end, lock) != end;
+
+        if (learningHostLocks)
+        {
+            if (! known && end != begin + hostLocks.size())
+                hostLocks[(size_t) numHostLocks.fetch_add(1)] = lock;
+
+            return true;
+        }
+
+        if (deliveringHostChange && known)
+        {
+            ++numHostLockCalls;
+            return true;
+        }
+
+        return false;
+    }
+
+    void report(const char* call)
+    {
+        reporting = true;
+        ++numViolations;
+
+        {
+            // Drop the getStackBacktrace() and report() frames; the trace
+            // then starts at the hook, naming the offending call
+            const auto trace = juce::SystemStats::getStackBacktrace()
+                                   .fromFirstOccurrenceOf("\n", false, false)
+                                   .fromFirstOccurrenceOf("\n", false, false);
+
+            const bool newSite = sites.insert(trace).second;
+
+            if (newSite && (int) sites.size() <= maxReports)
+                std::cerr << "\n── " << call << " inside the audio callback  [" << stage << "]\n" << trace << std::flush;
+        }   // trace is freed here, still inside the report
+
+        reporting = false;
+    }
+
+    inline void check(const char* call)
+    {
+        if (depth > 0 && ! reporting)
+            report(call);
+    }
+}
+
+//==============================================================================
+// Hooks
+//==============================================================================
+
+#if ENZOGAIN_HOOK_LIBC
+
+extern "C"
+{
+    void* __libc_malloc(size_t) noexcept;
+    void* __libc_calloc(size_t, size_t) noexcept;
+    void* __libc_realloc(void*, size_t) noexcept;
+    void* __libc_memalign(size_t, size_t) noexcept;
+    void  __libc_free(void*) noexcept;
+}
+
+namespace
+{
+    // The next definition of a libc symbol, resolved on first use into a
+    // constant-initialised atomic (a dynamic static's init guard can lock)
+    void* next(std::atomic<void*>& slot, const char* name) noexcept
+    {
+        auto* function = slot.load(std::memory_order_relaxed);
+
+        if (function == nullptr)
+        {
+            function = dlsym(RTLD_NEXT, name);
+            slot.store(function, std::memory_order_relaxed);
+        }
+
+        return function;
+    }
+}
+
+#define ENZOGAIN_NEXT(name) \
+    static std::atomic<void*> next_##name { nullptr }; \
+    const auto real = reinterpret_cast<decltype(&::name)>(next(next_##name, #name))
+
+extern "C"
+{
+    // ── Allocation ───────────────────────────────────────────────────────
+    void* malloc(size_t size) noexcept                  { RealtimeGuard::check("malloc"); return __libc_malloc(size); }
+    void* calloc(size_t count, size_t size) noexcept    { RealtimeGuard::check("calloc"); return __libc_calloc(count, size); }
+    void* realloc(void* ptr, size_t size) noexcept      { RealtimeGuard::check("realloc"); return __libc_realloc(ptr, size); }
+    void* memalign(size_t align, size_t size) noexcept  { RealtimeGuard::check("memalign"); return __libc_memalign(align, size); }
+    void* aligned_alloc(size_t align, size_t size) noexcept { RealtimeGuard::check("aligned_alloc"); return __libc_memalign(align, size); }
+
+    int posix_memalign(void** result, size_t align, size_t size) noexcept
+    {
+        RealtimeGuard::check("posix_memalign");
+        *result = __libc_memalign(align, size);
+        return *result != nullptr || size == 0 ? 0 : ENOMEM;
+    }
+
+    void free(void* ptr) noexcept
+    {
+        if (ptr != nullptr)
+            RealtimeGuard::check("free");
+
+        __libc_free(ptr);
+    }
+
+    // ── Locks and waits ──────────────────────────────────────────────────
+    int pthread_mutex_lock(pthread_mutex_t* mutex) noexcept
+    {
+        if (! RealtimeGuard::isHostLock(mutex))
+            RealtimeGuard::check("pthread_mutex_lock");
+
+        ENZOGAIN_NEXT(pthread_mutex_lock);
+        return real(mutex);
+    }
+
+    int pthread_rwlock_rdlock(pthread_rwlock_t* lock) noexcept
+    {
+        RealtimeGuard::check("pthread_rwlock_rdlock");
+        ENZOGAIN_NEXT(pthread_rwlock_rdlock);
+        return real(lock);
+    }
+
+    int pthread_rwlock_wrlock(pthread_rwlock_t* lock) noexcept
+    {
+        RealtimeGuard::check("pthread_rwlock_wrlock");
+        ENZOGAIN_NEXT(pthread_rwlock_wrlock);
+        return real(lock);
+    }
+
+    int pthread_cond_wait(pthread_cond_t* condition, pthread_mutex_t* mutex)
+    {
+        RealtimeGuard::check("pthread_cond_wait");
+        ENZOGAIN_NEXT(pthread_cond_wait);
+        return real(condition, mutex);
+    }
+
+    int pthread_cond_timedwait(pthread_cond_t* condition, pthread_mutex_t* mutex, const timespec* deadline)
+    {
+        RealtimeGuard::check("pthread_cond_timedwait");
+        ENZOGAIN_NEXT(pthread_cond_timedwait);
+        return real(condition, mutex, deadline);
+    }
+
+    int sem_wait(sem_t* semaphore)
+    {
+        RealtimeGuard::check("sem_wait");
+        ENZOGAIN_NEXT(sem_wait);
+        return real(semaphore);
+    }
+
+    int sem_timedwait(sem_t* semaphore, const timespec* deadline)
+    {
+        RealtimeGuard::check("sem_timedwait");
+        ENZOGAIN_NEXT(sem_timedwait);
+        return real(semaphore, deadline);
+    }
+
+    // ── Sleeps and file I/O ──────────────────────────────────────────────
+    int nanosleep(const timespec* duration, timespec* remaining)
+    {
+        RealtimeGuard::check("nanosleep");
+        ENZOGAIN_NEXT(nanosleep);
+        return real(duration, remaining);
+    }
+
+    int clock_nanosleep(clockid_t clock, int flags, const timespec* duration, timespec* remaining)
+    {
+        RealtimeGuard::check("clock_nanosleep");
+        ENZOGAIN_NEXT(clock_nanosleep);
+        return real(clock, flags, duration, remaining);
+    }
+
+    int usleep(useconds_t microseconds)
+    {
+        RealtimeGuard::check("usleep");
+        ENZOGAIN_NEXT(usleep);
+        return real(microseconds);
+    }
+
+    int open(const char* path, int flags, ...)
+    {
+        RealtimeGuard::check("open");
+        ENZOGAIN_NEXT(open);
+
+        mode_t mode = 0;
+
+        if ((flags & O_CREAT) != 0)
+        {
+            va_list args;
+            va_start(args, flags);
+            mode = (mode_t) va_arg(args, int);
+            va_end(args);
+        }
+
+        return real(path, flags, mode);
+    }
+
+    ssize_t read(int fd, void* data, size_t size)
+    {
+        RealtimeGuard::check("read");
+        ENZOGAIN_NEXT(read);
+        return real(fd, data, size);
+    }
+
+    ssize_t write(int fd, const void* data, size_t size)
+    {
+        RealtimeGuard::check("write");
+        ENZOGAIN_NEXT(write);
+        return real(fd, data, size);
+    }
+}
+
+#undef ENZOGAIN_NEXT
+
+#else
+
+// Portable fallback: the C++ allocator only
+void* operator new(size_t size)
+{
+    RealtimeGuard::check("operator new");
+
+    if (auto* ptr = std::malloc(size == 0 ? 1 : size))
+        return ptr;
+
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size)                                   { return operator new(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept     { RealtimeGuard::check("operator new"); return std::malloc(size == 0 ? 1 : size); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept   { RealtimeGuard::check("operator new[]"); return std::malloc(size == 0 ? 1 : size); }
+
+void operator delete(void* ptr) noexcept
+{
+    if (ptr != nullptr)
+        RealtimeGuard::check("operator delete");
+
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept                          { operator delete(ptr); }
+void operator delete(void* ptr, size_t) noexcept                    { operator delete(ptr); }
+void operator delete[](void* ptr, size_t) noexcept                  { operator delete(ptr); }
+
+#endif
+
+//==============================================================================
+// Driver
+//==============================================================================
+
+namespace
+{
+    constexpr int numCombinations = 2 * 2 * 5 * 4 * 4 * 2;   // LFO × SAT on × mode × quality × OS × filter
+    constexpr int blocksPerCombination = 4;
+
+    using EnzoGainBench::setParameter;
+
+    /** The discrete parameters of one combination. */
+    void applyCombination(EnzoGainAudioProcessor& processor, int combination)
+    {
+        setParameter(processor, "OS_FILTER",    (float) (combination % 2));   combination /= 2;
+        setParameter(processor, "OS_FACTOR",    (float) (combination % 4));   combination /= 4;
+        setParameter(processor, "SAT_QUALITY",  (float) (combination % 4));   combination /= 4;
+        setParameter(processor, "SAT_MODE",     (float) (combination % 5));   combination /= 5;
+        setParameter(processor, "SAT_ENABLED",  (float) (combination % 2));   combination /= 2;
+        setParameter(processor, "LFO_ENABLED",  (float) (combination % 2));
+    }
+
+    /** Message thread, before the run: records the locks each parameter's
+        change delivery takes while nothing of ours listens yet. */
+    void learnHostLocks(EnzoGainAudioProcessor& processor)
+    {
+        RealtimeGuard::numHostLocks = 0;
+        RealtimeGuard::learningHostLocks = true;
+
+        for (auto* parameter : processor.getParameters())
+            parameter->setValueNotifyingHost(parameter->getValue());
+
+        RealtimeGuard::learningHostLocks = false;
+    }
+
+    /** Stands in for the plugin wrapper, which always listens to its
+        processor: with a listener attached, updateHostDisplay and parameter
+        notifications take the processor's listener lock, as in a host. */
+    struct HostListener : juce::AudioProcessorListener
+    {
+        void audioProcessorParameterChanged(juce::AudioProcessor*, int, float) override {}
+        void audioProcessorChanged(juce::AudioProcessor*, const ChangeDetails&) override {}
+    };
+
+    /** Stands in for the host's audio thread, which is not the message
+        thread: runs each callback there while the caller waits. */
+    class AudioThread
+    {
+    public:
+        AudioThread() : thread([this] { run(); }) {}
+
+        ~AudioThread()
+        {
+            {
+                const std::lock_guard<std::mutex> lock(mutex);
+                quit = true;
+            }
+
+            wake.notify_all();
+            thread.join();
+        }
+
+        void call(const std::function<void()>& callback)
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            pending = &callback;
+            wake.notify_all();
+            wake.wait(lock, [this] { return pending == nullptr; });
+        }
+
+    private:
+        void run()
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+
+            for (;;)
+            {
+                wake.wait(lock, [this] { return quit || pending != nullptr; });
+
+                if (quit)
+                    return;
+
+                lock.unlock();
+                (*pending)();
+                lock.lock();
+
+                pending = nullptr;
+                wake.notify_all();
+            }
+        }
+
+        std::mutex mutex;
+        std::condition_variable wake;
+        const std::function<void()>* pending = nullptr;
+        bool quit = false;
+        std::thread thread;   // last: started once the rest exists
+    };
+
+    enum class Editor { closed, web, native };
+
+    class Run
+    {
+    public:
+        Run(EnzoGainAudioProcessor& p, int channels, int blockSize, uint32_t seed)
+            : processor(p), numChannels(channels), maxBlockSize(blockSize), rng(seed)
+        {
+        }
+
+        template <typename SampleType>
+        void process()
+        {
+            juce::AudioBuffer<SampleType> buffer(numChannels, maxBlockSize);
+            std::vector<juce::MemoryBlock> states;
+
+            for (int combination = 0; combination < numCombinations; ++combination)
+            {
+                const auto editor = (Editor) ((combination / 7) % 3);
+                setEditor(editor, combination % 3 == 0);
+
+                for (int block = 0; block < blocksPerCombination; ++block)
+                {
+                    // Full blocks, then a host that sends fewer samples than
+                    // prepared; the combination's switches arrive with the first
+                    const int numSamples = block % 2 == 0 ? maxBlockSize : maxBlockSize / 3 + 1;
+                    callback(buffer, numSamples, block == 0 ? combination : -1);
+
+                    if (editor == Editor::web)
+                        drainMeters();
+                }
+
+                if (combination % 16 == 0)
+                {
+                    states.emplace_back();
+                    processor.getStateInformation(states.back());
+                }
+            }
+
+            // State restores, as a host recalling a preset would do them
+            for (const auto& state : states)
+            {
+                processor.setStateInformation(state.getData(), (int) state.getSize());
+
+                for (int block = 0; block < blocksPerCombination; ++block)
+                    callback(buffer, maxBlockSize);
+            }
+
+            setEditor(Editor::closed, false);
+            callback(buffer, maxBlockSize);
+        }
+
+        int getNumBlocks() const noexcept { return numBlocks; }
+
+    private:
+        /** Message thread: opens / closes editors as a host would. */
+        void setEditor(Editor editor, bool inputTap)
+        {
+            const bool web = editor == Editor::web;
+
+            // What the WebView editor switches on the processor while showing
+            processor.setMeteringEnabled(web);
+            processor.setAnalyserTaps(web, web && inputTap);
+
+            if (editor != Editor::native)
+                nativeEditor.reset();
+            else if (nativeEditor == nullptr)
+                nativeEditor = std::make_unique<EnzoGainNativeEditor>(processor);
+        }
+
+        template <typename SampleType>
+        void callback(juce::AudioBuffer<SampleType>& storage, int numSamples, int combination = -1)
+        {
+            std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+            for (int channel = 0; channel < numChannels; ++channel)
+                for (int i = 0; i < numSamples; ++i)
+                    storage.setSample(channel, i, (SampleType) (0.5f * unit(rng)));
+
+            juce::AudioBuffer<SampleType> buffer(storage.getArrayOfWritePointers(), numChannels, numSamples);
+            const auto position = processor.getSamplePosition() + (juce::int64) (numSamples * unit(rng) * 0.5f + numSamples * 0.5f);
+            const float drive = 50.0f + 50.0f * unit(rng);
+
+            const std::function<void()> audioCallback = [&]
+            {
+                RealtimeGuard::ScopedAudioThread checked;
+
+                // Host automation, delivered as the wrappers do before processing
+                {
+                    RealtimeGuard::ScopedHostChange delivery;
+
+                    if (combination >= 0)
+                        applyCombination(processor, combination);
+
+                    EnzoGainBench::randomiseContinuous(processor, rng);
+                }
+
+                processor.scheduleParameterChange(EnzoGainAudioProcessor::driveParam, position, drive);
+                processor.processBlock(buffer, midi);
+            };
+
+            audioThread.call(audioCallback);
+
+            ++numBlocks;
+        }
+
+        void drainMeters()
+        {
+            while (processor.popMeterFrames(meterFrames.data(), (int) meterFrames.size()) > 0) {}
+        }
+
+        EnzoGainAudioProcessor& processor;
+        const int numChannels;
+        const int maxBlockSize;
+        std::mt19937 rng;
+        juce::MidiBuffer midi;
+        std::array<EnzoGainDSP::MeterFrame, EnzoGainDSP::MeterFifo::capacity> meterFrames;
+        std::unique_ptr<EnzoGainNativeEditor> nativeEditor;
+        AudioThread audioThread;
+        int numBlocks = 0;
+    };
+}
+
+int main(int argc, char* argv[])
+{
+    EnzoGainBench::ScopedJuceRuntime juceRuntime;
+
+    bool quick = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const juce::String arg(argv[i]);
+
+        if (arg == "--quick")                              quick = true;
+        else if (arg == "--max-reports" && i + 1 < argc)   RealtimeGuard::maxReports = juce::jmax(0, std::atoi(argv[++i]));
+        else
+        {
+            std::cerr << "usage: " << argv[0] << " [--quick] [--max-reports n]\n";
+            return 2;
+        }
+    }
+
+    using Set = juce::AudioChannelSet;
+
+    const std::pair<const char*, Set> layouts[] =
+    {
+        { "stereo", Set::stereo() },
+        { "mono", Set::mono() },
+        { "5.1", Set::create5point1() },
+        { "ambisonic-3", Set::ambisonic(3) },
+    };
+
+    const std::pair<int, double> configurations[] = { { 16, 44100.0 }, { 512, 96000.0 } };
+
+    int numBlocks = 0;
+    uint32_t seed = 1;
+
+    for (const auto& [layoutName, layout] : layouts)
+    {
+        for (const bool doublePrecision : { false, true })
+        {
+            for (const auto& [blockSize, sampleRate] : configurations)
+            {
+                EnzoGainAudioProcessor processor;
+                HostListener host;
+                processor.addListener(&host);
+
+                juce::AudioProcessor::BusesLayout buses;
+                buses.inputBuses.add(layout);
+                buses.outputBuses.add(layout);
+
+                if (! processor.setBusesLayout(buses))
+                {
+                    std::cerr << "layout " << layoutName << " rejected\n";
+                    return 2;
+                }
+
+                processor.setProcessingPrecision(doublePrecision ? juce::AudioProcessor::doublePrecision
+                                                                 : juce::AudioProcessor::singlePrecision);
+                processor.setRateAndBufferSizeDetails(sampleRate, blockSize);
+                processor.prepareToPlay(sampleRate, blockSize);
+
+                RealtimeGuard::stage = (juce::String(layoutName) + ", " + (doublePrecision ? "double" : "float")
+                                     + ", " + juce::String(blockSize) + " @ " + juce::String(sampleRate) + " Hz").toStdString();
+
+                learnHostLocks(processor);
+                Run run(processor, layout.size(), blockSize, seed++);
+
+                if (doublePrecision)
+                    run.process<double>();
+                else
+                    run.process<float>();
+
+                processor.releaseResources();
+                processor.removeListener(&host);
+                numBlocks += run.getNumBlocks();
+
+                std::cout << RealtimeGuard::stage << ": " << run.getNumBlocks() << " blocks\n";
+
+                if (quick)
+                    break;
+            }
+
+            if (quick)
+                break;
+        }
+
+        if (quick)
+            break;
+    }
+
+    const int violations = RealtimeGuard::numViolations.load();
+
+    std::cout << "\n" << numBlocks << " processBlock calls checked, " << violations << " violations at "
+              << RealtimeGuard::sites.size() << " call sites"
+              << (ENZOGAIN_HOOK_LIBC ? "" : " (allocator hooks only on this platform)") << "\n"
+              << RealtimeGuard::numHostLockCalls.load() << " listener locks taken by the host's own parameter delivery, not counted\n";
+
+    return violations == 0 ? 0 : 1;
+}
@@ -0,0 +1,299 @@
+/*
+ * Dense-session stress test.
+ *
+ * Creates N headless EnzoGainAudioProcessor instances with randomised
+ * parameter states and runs them inside a simulated host callback at a
+ * fixed buffer size and sample rate.  Each callback every instance gets
+ * its input copied in, a little random-walk automation (gain, pan, drive)
+ * and one processBlock call.  Callbacks can be spread across a worker
+ * pool the way a multi-threaded host schedules independent tracks.
+ *
+ * The callback budget is blockSize / sampleRate.  Callbacks are issued
+ * back to back, not paced, so the numbers are pure DSP cost:
+ *
+ *   dsp_load            mean callback time / budget
+ *   per_instance_us     mean processBlock time of one instance
+ *   deadline_miss_rate  fraction of callbacks that overran the budget
+ *   worst_callback_us   slowest callback
+ *   worst_block_us      slowest single processBlock call
+ *
+ * Options:
+ *   --instances <n>  (200)     --workers <n>  (1 = callback thread only)
+ *   --block <n>      (128)     --rate <hz>    (48000)
+ *   --seconds <s>    (10)      --seed <n>     (1)
+ *   --json
+ */
+
+#include "BenchmarkSupport.h"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <thread>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double elapsedNs(Clock::time_point t0, Clock::time_point t1)
+    {
+        return std::chrono::duration<double, std::nano>(t1 - t0).count();
+    }
+
+    using EnzoGainBench::setParameter;
+
+    /** One track: a processor, its own I/O buffer and its automation state. */
+    struct Instance
+    {
+        Instance(int numChannels, int blockSize, uint32_t seed)
+            : buffer(numChannels, blockSize), rng(seed)
+        {
+            // Saturation on most tracks, oversampling and the LFO on some
+            const auto values = EnzoGainBench::randomise(*processor, rng, { 0.6f, 0.2f, 0.3f });
+            gain  = values.gain;
+            pan   = values.pan;
+            drive = values.drive;
+        }
+
+        /** Host-side automation: roughly one callback in ten nudges a parameter. */
+        void automate()
+        {
+            std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+            if (unit(rng) >= 0.1f)
+                return;
+
+            const float step = unit(rng) - 0.5f;
+
+            switch ((int) (3.0f * unit(rng)))
+            {
+                case 0:  gain  = juce::jlimit(0.0f, 1.5f, gain + 0.1f * step);       setParameter(*processor, "GAIN", gain);       break;
+                case 1:  pan   = juce::jlimit(-100.0f, 100.0f, pan + 20.0f * step);  setParameter(*processor, "PAN", pan);         break;
+                default: drive = juce::jlimit(0.0f, 100.0f, drive + 20.0f * step);   setParameter(*processor, "SAT_DRIVE", drive); break;
+            }
+        }
+
+        std::unique_ptr<EnzoGainAudioProcessor> processor = std::make_unique<EnzoGainAudioProcessor>();
+        juce::AudioBuffer<float> buffer;
+        std::mt19937 rng;
+        float gain = 1.0f, pan = 0.0f, drive = 0.0f;
+
+        double totalNs = 0.0, worstNs = 0.0;
+    };
+
+    /**
+     * Spinning worker pool: the callback thread bumps a generation counter,
+     * then everybody (callback thread included) claims instances from a
+     * shared index until none are left.  No locks, no allocation.
+     */
+    class WorkerPool
+    {
+    public:
+        WorkerPool(int numWorkers, std::vector<std::unique_ptr<Instance>>& instancesToRun,
+                   const juce::AudioBuffer<float>& inputToUse)
+            : instances(instancesToRun), input(inputToUse)
+        {
+            for (int i = 1; i < numWorkers; ++i)
+                threads.emplace_back([this] { workerLoop(); });
+        }
+
+        ~WorkerPool()
+        {
+            quit.store(true);
+            generation.fetch_add(1);
+
+            for (auto& thread : threads)
+                thread.join();
+        }
+
+        void runCallback()
+        {
+            // remaining before nextInstance: a worker still leaving the previous
+            // callback can only claim an index past the end until the reset
+            remaining.store((int) instances.size());
+            nextInstance.store(0);
+            generation.fetch_add(1, std::memory_order_release);
+
+            drain();
+
+            while (remaining.load(std::memory_order_acquire) > 0)
+                std::this_thread::yield();
+        }
+
+    private:
+        void workerLoop()
+        {
+            uint64_t seen = generation.load();
+
+            for (;;)
+            {
+                while (generation.load(std::memory_order_acquire) == seen)
+                    std::this_thread::yield();
+
+                seen = generation.load();
+
+                if (quit.load())
+                    return;
+
+                drain();
+            }
+        }
+
+        void drain()
+        {
+            juce::MidiBuffer midi;
+
+            for (;;)
+            {
+                const int index = nextInstance.fetch_add(1);
+
+                if (index >= (int) instances.size())
+                    return;
+
+                auto& instance = *instances[(size_t) index];
+
+                for (int channel = 0; channel < instance.buffer.getNumChannels(); ++channel)
+                    instance.buffer.copyFrom(channel, 0, input, channel, 0, input.getNumSamples());
+
+                instance.automate();
+
+                const auto t0 = Clock::now();
+                instance.processor->processBlock(instance.buffer, midi);
+                const auto t1 = Clock::now();
+
+                const double ns = elapsedNs(t0, t1);
+                instance.totalNs += ns;
+                instance.worstNs  = juce::jmax(instance.worstNs, ns);
+
+                remaining.fetch_sub(1, std::memory_order_acq_rel);
+            }
+        }
+
+        std::vector<std::unique_ptr<Instance>>& instances;
+        const juce::AudioBuffer<float>& input;
+        std::vector<std::thread> threads;
+        std::atomic<uint64_t> generation { 0 };
+        std::atomic<int> nextInstance { 0 }, remaining { 0 };
+        std::atomic<bool> quit { false };
+    };
+}
+
+int main(int argc, char* argv[])
+{
+    EnzoGainBench::ScopedJuceRuntime juceRuntime;
+
+    int numInstances = 200, numWorkers = 1, blockSize = 128;
+    double sampleRate = 48000.0, seconds = 10.0;
+    uint32_t seed = 1;
+    bool json = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const juce::String arg(argv[i]);
+        const bool hasValue = i + 1 < argc;
+
+        if (arg == "--json")                         json = true;
+        else if (arg == "--instances" && hasValue)   numInstances = juce::jmax(1, std::atoi(argv[++i]));
+        else if (arg == "--workers" && hasValue)     numWorkers   = juce::jmax(1, std::atoi(argv[++i]));
+        else if (arg == "--block" && hasValue)       blockSize    = juce::jlimit(1, 8192, std::atoi(argv[++i]));
+        else if (arg == "--rate" && hasValue)        sampleRate   = juce::jmax(8000.0, std::atof(argv[++i]));
+        else if (arg == "--seconds" && hasValue)     seconds      = juce::jmax(0.1, std::atof(argv[++i]));
+        else if (arg == "--seed" && hasValue)        seed         = (uint32_t) std::atoi(argv[++i]);
+        else
+        {
+            std::cerr << "usage: " << argv[0] << " [--instances n] [--workers n] [--block n] [--rate hz]"
+                                                 " [--seconds s] [--seed n] [--json]\n";
+            return 1;
+        }
+    }
+
+    constexpr int numChannels = 2;
+
+    // ── Session setup ────────────────────────────────────────────────────
+    std::vector<std::unique_ptr<Instance>> instances;
+    instances.reserve((size_t) numInstances);
+
+    for (int i = 0; i < numInstances; ++i)
+    {
+        instances.push_back(std::make_unique<Instance>(numChannels, blockSize, seed * 7919u + (uint32_t) i));
+        instances.back()->processor->setRateAndBufferSizeDetails(sampleRate, blockSize);
+        instances.back()->processor->prepareToPlay(sampleRate, blockSize);
+    }
+
+    juce::AudioBuffer<float> input(numChannels, blockSize);
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> noise(-0.5f, 0.5f);
+
+    for (int channel = 0; channel < numChannels; ++channel)
+        for (int i = 0; i < blockSize; ++i)
+            input.setSample(channel, i, noise(rng));
+
+    // ── Simulated host callbacks ─────────────────────────────────────────
+    WorkerPool pool(numWorkers, instances, input);
+
+    const double budgetNs = blockSize / sampleRate * 1.0e9;
+    const int numCallbacks = juce::jmax(1, (int) (seconds * sampleRate) / blockSize);
+    const int warmUpCallbacks = juce::jmax(4, numCallbacks / 100);
+
+    for (int i = 0; i < warmUpCallbacks; ++i)
+        pool.runCallback();
+
+    for (auto& instance : instances)
+        instance->totalNs = instance->worstNs = 0.0;
+
+    double totalNs = 0.0, worstCallbackNs = 0.0;
+    int misses = 0;
+
+    for (int i = 0; i < numCallbacks; ++i)
+    {
+        const auto t0 = Clock::now();
+        pool.runCallback();
+        const auto t1 = Clock::now();
+
+        const double ns = elapsedNs(t0, t1);
+        totalNs += ns;
+        worstCallbackNs = juce::jmax(worstCallbackNs, ns);
+        misses += ns > budgetNs ? 1 : 0;
+    }
+
+    // ── Report ───────────────────────────────────────────────────────────
+    double instanceNs = 0.0, worstBlockNs = 0.0;
+
+    for (auto& instance : instances)
+    {
+        instanceNs  += instance->totalNs;
+        worstBlockNs = juce::jmax(worstBlockNs, instance->worstNs);
+    }
+
+    const double dspLoad         = totalNs / (numCallbacks * budgetNs);
+    const double perInstanceUs   = instanceNs / ((double) numCallbacks * numInstances) * 1.0e-3;
+    const double missRate        = (double) misses / numCallbacks;
+    const double worstCallbackUs = worstCallbackNs * 1.0e-3;
+    const double worstBlockUs    = worstBlockNs * 1.0e-3;
+
+    if (json)
+    {
+        std::cout << "{ \"instances\": " << numInstances << ", \"workers\": " << numWorkers
+                  << ", \"block_size\": " << blockSize << ", \"sample_rate\": " << sampleRate
+                  << ", \"callbacks\": " << numCallbacks << ", \"budget_us\": " << budgetNs * 1.0e-3
+                  << ", \"dsp_load\": " << dspLoad << ", \"per_instance_us\": " << perInstanceUs
+                  << ", \"deadline_miss_rate\": " << missRate << ", \"worst_callback_us\": " << worstCallbackUs
+                  << ", \"worst_block_us\": " << worstBlockUs << " }\n";
+    }
+    else
+    {
+        std::cout << "instances           " << numInstances << '\n'
+                  << "workers             " << numWorkers << '\n'
+                  << "block / rate        " << blockSize << " @ " << sampleRate << " Hz\n"
+                  << "callbacks           " << numCallbacks << '\n'
+                  << "budget_us           " << budgetNs * 1.0e-3 << '\n'
+                  << "dsp_load            " << dspLoad * 100.0 << " %\n"
+                  << "per_instance_us     " << perInstanceUs << '\n'
+                  << "deadline_miss_rate  " << missRate * 100.0 << " %\n"
+                  << "worst_callback_us   " << worstCallbackUs << '\n'
+                  << "worst_block_us      " << worstBlockUs << '\n';
+    }
+
+    return 0;
+}
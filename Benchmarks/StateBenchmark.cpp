@@ -0,0 +1,160 @@
+/*
+ * State save / load benchmark: the binary state format against XML.
+ *
+ * Creates N headless processors with randomised parameter states, then
+ * for each format saves every instance's state and recalls it into the
+ * next instance (so every load changes most values, as a session or
+ * preset recall does), for a number of rounds.  Per format:
+ *
+ *   bytes         size of one saved state
+ *   save_us       getStateInformation, mean and worst
+ *   load_us       setStateInformation, mean and worst
+ *   session_ms    recalling the state of all N instances, mean
+ *
+ * The XML rows are the path of earlier versions (getXmlStateInformation,
+ * and setStateInformation reading it back), which is still supported.
+ *
+ * Options:
+ *   --instances <n>  (200)    --rounds <n>  (20)    --seed <n>  (1)
+ *   --json
+ */
+
+#include "BenchmarkSupport.h"
+
+#include <chrono>
+#include <iostream>
+#include <random>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double elapsedUs(Clock::time_point t0, Clock::time_point t1)
+    {
+        return std::chrono::duration<double, std::micro>(t1 - t0).count();
+    }
+
+    struct FormatResult
+    {
+        const char* name;
+        size_t bytes = 0;
+        double meanSaveUs = 0.0, worstSaveUs = 0.0;
+        double meanLoadUs = 0.0, worstLoadUs = 0.0;
+        double meanSessionMs = 0.0;
+    };
+
+    FormatResult measure(const char* name, bool xml,
+                         std::vector<std::unique_ptr<EnzoGainAudioProcessor>>& processors, int numRounds)
+    {
+        FormatResult result { name };
+        const int numInstances = (int) processors.size();
+        std::vector<juce::MemoryBlock> states((size_t) numInstances);
+
+        for (int round = 0; round < numRounds; ++round)
+        {
+            // ── Save ─────────────────────────────────────────────────────
+            for (int i = 0; i < numInstances; ++i)
+            {
+                auto& processor = *processors[(size_t) i];
+                auto& state = states[(size_t) i];
+
+                const auto t0 = Clock::now();
+
+                if (xml)
+                    processor.getXmlStateInformation(state);
+                else
+                    processor.getStateInformation(state);
+
+                const double us = elapsedUs(t0, Clock::now());
+                result.meanSaveUs += us;
+                result.worstSaveUs = juce::jmax(result.worstSaveUs, us);
+                result.bytes = juce::jmax(result.bytes, state.getSize());
+            }
+
+            // ── Recall, each instance taking the next one's state ────────
+            const auto session0 = Clock::now();
+
+            for (int i = 0; i < numInstances; ++i)
+            {
+                const auto& state = states[(size_t) ((i + 1) % numInstances)];
+
+                const auto t0 = Clock::now();
+                processors[(size_t) i]->setStateInformation(state.getData(), (int) state.getSize());
+
+                const double us = elapsedUs(t0, Clock::now());
+                result.meanLoadUs += us;
+                result.worstLoadUs = juce::jmax(result.worstLoadUs, us);
+            }
+
+            result.meanSessionMs += elapsedUs(session0, Clock::now()) / 1000.0;
+        }
+
+        const double numOperations = (double) numInstances * numRounds;
+        result.meanSaveUs /= numOperations;
+        result.meanLoadUs /= numOperations;
+        result.meanSessionMs /= numRounds;
+        return result;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    EnzoGainBench::ScopedJuceRuntime juceRuntime;
+
+    int numInstances = 200, numRounds = 20;
+    uint32_t seed = 1;
+    bool json = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const juce::String arg(argv[i]);
+        const bool hasValue = i + 1 < argc;
+
+        if (arg == "--json")                         json = true;
+        else if (arg == "--instances" && hasValue)   numInstances = juce::jmax(2, std::atoi(argv[++i]));
+        else if (arg == "--rounds" && hasValue)      numRounds    = juce::jmax(1, std::atoi(argv[++i]));
+        else if (arg == "--seed" && hasValue)        seed         = (uint32_t) std::atoi(argv[++i]);
+        else
+        {
+            std::cerr << "usage: " << argv[0] << " [--instances n] [--rounds n] [--seed n] [--json]\n";
+            return 1;
+        }
+    }
+
+    std::vector<std::unique_ptr<EnzoGainAudioProcessor>> processors;
+    std::mt19937 rng(seed);
+
+    for (int i = 0; i < numInstances; ++i)
+    {
+        processors.push_back(std::make_unique<EnzoGainAudioProcessor>());
+        EnzoGainBench::randomise(*processors.back(), rng);
+    }
+
+    const FormatResult results[] = { measure("xml",    true,  processors, numRounds),
+                                     measure("binary", false, processors, numRounds) };
+
+    if (json)
+    {
+        std::cout << "[";
+
+        for (size_t i = 0; i < std::size(results); ++i)
+        {
+            const auto& r = results[i];
+            std::cout << (i > 0 ? ", " : " ") << "{ \"format\": \"" << r.name << "\", \"bytes\": " << r.bytes
+                      << ", \"save_us_mean\": " << r.meanSaveUs << ", \"save_us_worst\": " << r.worstSaveUs
+                      << ", \"load_us_mean\": " << r.meanLoadUs << ", \"load_us_worst\": " << r.worstLoadUs
+                      << ", \"session_ms\": " << r.meanSessionMs << " }";
+        }
+
+        std::cout << " ]\n";
+        return 0;
+    }
+
+    std::cout << "format,bytes,save_us_mean,save_us_worst,load_us_mean,load_us_worst,session_ms\n";
+
+    for (const auto& r : results)
+        std::cout << r.name << ',' << r.bytes << ',' << r.meanSaveUs << ',' << r.worstSaveUs << ','
+                  << r.meanLoadUs << ',' << r.worstLoadUs << ',' << r.meanSessionMs << '\n';
+
+    return 0;
+}
@@ -0,0 +1,91 @@
+/*
+ * Channel-balance check for surround beds.
+ *
+ * A 5.1 bed at PAN 0, GAIN 100 %, saturation and LFO off must come out
+ * at unity on every channel, in float and double precision.  Prints the
+ * worst deviation per precision and exits non-zero if either is over
+ * 1e-6 — so the tool can gate CI next to EnzoGain_RealtimeSafetyCheck.
+ */
+
+#include "BenchmarkSupport.h"
+
+#include <iostream>
+#include <type_traits>
+
+namespace
+{
+    constexpr double tolerance = 1.0e-6;
+
+    using EnzoGainBench::setParameter;
+
+    /** Worst deviation from the input of a 5.1 bed at neutral settings.
+        A constant level per channel, so the last block is past both the
+        smoothers and the reported latency. */
+    template <typename SampleType>
+    double surroundUnityError()
+    {
+        constexpr int blockSize = 512, numBlocks = 16;
+
+        const auto bed = juce::AudioChannelSet::create5point1();
+        EnzoGainAudioProcessor processor;
+
+        juce::AudioProcessor::BusesLayout buses;
+        buses.inputBuses.add(bed);
+        buses.outputBuses.add(bed);
+        processor.setBusesLayout(buses);
+
+        setParameter(processor, "GAIN",        1.0f);
+        setParameter(processor, "PAN",         0.0f);
+        setParameter(processor, "SAT_ENABLED", 0.0f);
+        setParameter(processor, "LFO_ENABLED", 0.0f);
+
+        processor.setProcessingPrecision(std::is_same_v<SampleType, double> ? juce::AudioProcessor::doublePrecision
+                                                                            : juce::AudioProcessor::singlePrecision);
+        processor.setRateAndBufferSizeDetails(48000.0, blockSize);
+        processor.prepareToPlay(48000.0, blockSize);
+
+        const int numChannels = bed.size();
+        juce::AudioBuffer<SampleType> buffer(numChannels, blockSize);
+        juce::MidiBuffer midi;
+
+        const auto level = [] (int channel) { return SampleType(0.1) * SampleType(channel + 1); };
+
+        for (int block = 0; block < numBlocks; ++block)
+        {
+            for (int channel = 0; channel < numChannels; ++channel)
+                juce::FloatVectorOperations::fill(buffer.getWritePointer(channel), level(channel), blockSize);
+
+            processor.processBlock(buffer, midi);
+        }
+
+        double worst = 0.0;
+
+        for (int channel = 0; channel < numChannels; ++channel)
+            for (int i = 0; i < blockSize; ++i)
+                worst = juce::jmax(worst, (double) std::abs(buffer.getSample(channel, i) - level(channel)));
+
+        processor.releaseResources();
+        return worst;
+    }
+
+    /** Prints one precision's result; true if it is within tolerance. */
+    bool report(const char* precision, double error)
+    {
+        const bool unity = error <= tolerance;
+
+        std::cout << "5.1 at PAN 0, GAIN 100 %, saturation off, " << precision << ": "
+                  << (unity ? "unity on every channel" : "off unity by " + juce::String(error).toStdString()) << "\n";
+
+        return unity;
+    }
+}
+
+int main()
+{
+    EnzoGainBench::ScopedJuceRuntime juceRuntime;
+
+    const bool singleUnity = report("float",  surroundUnityError<float>());
+    const bool doubleUnity = report("double", surroundUnityError<double>());
+
+    return singleUnity && doubleUnity ? 0 : 1;
+}
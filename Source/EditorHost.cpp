@@ -0,0 +1,77 @@
+#include "EditorHost.h"
+#include "PluginEditor.h"
+#include "NativeEditor.h"
+
+EnzoGainEditorHost::EnzoGainEditorHost(EnzoGainAudioProcessor& p)
+    : AudioProcessorEditor(&p), processorRef(p)
+{
+    showEditor(processorRef.getEditorMode());
+    processorRef.parameters.state.addListener(this);
+    setResizable(false, false);
+}
+
+EnzoGainEditorHost::~EnzoGainEditorHost()
+{
+    cancelPendingUpdate();
+    processorRef.parameters.state.removeListener(this);
+}
+
+void EnzoGainEditorHost::resized()
+{
+    if (content != nullptr)
+        content->setBounds(getLocalBounds());
+}
+
+void EnzoGainEditorHost::childBoundsChanged(juce::Component* child)
+{
+    // Follow the content's own size changes (the WebView editor grows with the LFO panel)
+    if (child == content.get())
+        setSize(child->getWidth(), child->getHeight());
+}
+
+double EnzoGainEditorHost::getOpenToFirstPaintMs() const noexcept
+{
+    if (auto* web = dynamic_cast<EnzoGainAudioProcessorEditor*>(content.get()))
+        return web->getOpenToFirstPaintMs();
+
+    if (auto* native = dynamic_cast<EnzoGainNativeEditor*>(content.get()))
+        return native->getOpenToFirstPaintMs();
+
+    return 0.0;
+}
+
+void EnzoGainEditorHost::valueTreePropertyChanged(juce::ValueTree& tree, const juce::Identifier& property)
+{
+    if (tree == processorRef.parameters.state && property == EnzoGainAudioProcessor::editorModeProperty)
+        triggerAsyncUpdate();
+}
+
+void EnzoGainEditorHost::valueTreeRedirected(juce::ValueTree&)
+{
+    // setStateInformation() replaced the whole state
+    triggerAsyncUpdate();
+}
+
+void EnzoGainEditorHost::handleAsyncUpdate()
+{
+    const auto mode = processorRef.getEditorMode();
+
+    if (mode != currentMode)
+        showEditor(mode);
+}
+
+void EnzoGainEditorHost::showEditor(EnzoGainAudioProcessor::EditorMode mode)
+{
+    // The old editor goes first, so the two never hold their resources at once
+    content.reset();
+    currentMode = mode;
+
+    if (mode == EnzoGainAudioProcessor::EditorMode::native)
+        content = std::make_unique<EnzoGainNativeEditor>(processorRef);
+    else
+        content = std::make_unique<EnzoGainAudioProcessorEditor>(processorRef);
+
+    setSize(content->getWidth(), content->getHeight());
+    addAndMakeVisible(*content);
+    content->setBounds(getLocalBounds());
+}
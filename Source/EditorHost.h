@@ -0,0 +1,45 @@
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+#include <juce_audio_processors/juce_audio_processors.h>
+#include "PluginProcessor.h"
+
+/**
+ * The editor EnzoGain gives its host
+ *
+ * Holds either the WebView editor or the native one, as chosen by the
+ * processor's saved editor mode, and takes the size of whichever it
+ * shows.  Switching the mode (from either editor, or by restoring a state
+ * saved with the other one) rebuilds the content on the next message
+ * loop iteration, never from inside the switching editor's own callback.
+ */
+
+class EnzoGainEditorHost : public juce::AudioProcessorEditor,
+                           private juce::ValueTree::Listener,
+                           private juce::AsyncUpdater
+{
+public:
+    explicit EnzoGainEditorHost(EnzoGainAudioProcessor& p);
+    ~EnzoGainEditorHost() override;
+
+    void resized() override;
+    void childBoundsChanged(juce::Component* child) override;
+
+    EnzoGainAudioProcessor::EditorMode getCurrentMode() const noexcept { return currentMode; }
+
+    /** The shown editor's construction-to-first-paint time; 0 until it has painted. */
+    double getOpenToFirstPaintMs() const noexcept;
+
+private:
+    void valueTreePropertyChanged(juce::ValueTree& tree, const juce::Identifier& property) override;
+    void valueTreeRedirected(juce::ValueTree& tree) override;
+    void handleAsyncUpdate() override;
+
+    void showEditor(EnzoGainAudioProcessor::EditorMode mode);
+
+    EnzoGainAudioProcessor& processorRef;
+    EnzoGainAudioProcessor::EditorMode currentMode = EnzoGainAudioProcessor::EditorMode::web;
+    std::unique_ptr<juce::AudioProcessorEditor> content;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(EnzoGainEditorHost)
+};
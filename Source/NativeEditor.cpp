@@ -0,0 +1,306 @@
+#include "NativeEditor.h"
+
+namespace
+{
+    // The WebView editor's palette
+    const juce::Colour backgroundTop    { 0xffe8f0e4 };
+    const juce::Colour backgroundBottom { 0xffdce8d6 };
+    const juce::Colour panelFill        { 0x66ffffff };
+    const juce::Colour panelOutline     { 0xffc4d4be };
+    const juce::Colour accent           { 0xff4a8a42 };
+    const juce::Colour accentDark       { 0xff2e5a28 };
+    const juce::Colour text             { 0xff2a2e28 };
+    const juce::Colour mutedText        { 0xff5a6a54 };
+
+    const char* const satModeNames[] = { "Tape", "Tube", "Digi", "Fold" };
+
+    // Short forms of the SAT_QUALITY / OS_FACTOR / OS_FILTER choices, in
+    // choice order (the attachments map item index to choice index)
+    const juce::StringArray satQualityNames { "Fast", "Reference", "ADAA 1st", "ADAA 2nd" };
+    const juce::StringArray osFactorNames   { "OS 1x", "OS 2x", "OS 4x", "OS 8x" };
+    const juce::StringArray osFilterNames   { "IIR", "FIR" };
+}
+
+//==============================================================================
+// Constructor
+//==============================================================================
+
+EnzoGainNativeEditor::EnzoGainNativeEditor(EnzoGainAudioProcessor& p)
+    : AudioProcessorEditor(&p), processorRef(p)
+{
+    lookAndFeel.setColour(juce::Slider::rotarySliderFillColourId, accent);
+    lookAndFeel.setColour(juce::Slider::rotarySliderOutlineColourId, panelOutline);
+    lookAndFeel.setColour(juce::Slider::thumbColourId, accentDark);
+    lookAndFeel.setColour(juce::Slider::textBoxTextColourId, text);
+    lookAndFeel.setColour(juce::Slider::textBoxOutlineColourId, juce::Colours::transparentBlack);
+    lookAndFeel.setColour(juce::Label::textColourId, mutedText);
+    lookAndFeel.setColour(juce::ToggleButton::textColourId, text);
+    lookAndFeel.setColour(juce::ToggleButton::tickColourId, accentDark);
+    lookAndFeel.setColour(juce::ToggleButton::tickDisabledColourId, mutedText);
+    lookAndFeel.setColour(juce::TextButton::buttonColourId, backgroundTop);
+    lookAndFeel.setColour(juce::TextButton::buttonOnColourId, accent);
+    lookAndFeel.setColour(juce::TextButton::textColourOffId, mutedText);
+    lookAndFeel.setColour(juce::TextButton::textColourOnId, juce::Colours::white);
+    lookAndFeel.setColour(juce::ComboBox::backgroundColourId, backgroundTop);
+    lookAndFeel.setColour(juce::ComboBox::textColourId, text);
+    lookAndFeel.setColour(juce::ComboBox::outlineColourId, panelOutline);
+    lookAndFeel.setColour(juce::ComboBox::arrowColourId, mutedText);
+    lookAndFeel.setColour(juce::PopupMenu::backgroundColourId, backgroundTop);
+    lookAndFeel.setColour(juce::PopupMenu::textColourId, text);
+    lookAndFeel.setColour(juce::PopupMenu::highlightedBackgroundColourId, accent);
+    lookAndFeel.setColour(juce::PopupMenu::highlightedTextColourId, juce::Colours::white);
+    setLookAndFeel(&lookAndFeel);
+
+    auto& state = processorRef.parameters;
+
+    // ── Knobs ────────────────────────────────────────────────────────
+    setUpKnob(gainKnob, gainLabel, "Gain");
+    setUpKnob(panKnob, panLabel, "Pan");
+    setUpKnob(driveKnob, driveLabel, "Drive");
+    setUpKnob(lfoStrengthKnob, lfoStrengthLabel, "Strength");
+    setUpKnob(lfoFreqKnob, lfoFreqLabel, "Frequency");
+
+    gainAttachment        = std::make_unique<SliderAttachment>(state, "GAIN", gainKnob);
+    panAttachment         = std::make_unique<SliderAttachment>(state, "PAN", panKnob);
+    driveAttachment       = std::make_unique<SliderAttachment>(state, "SAT_DRIVE", driveKnob);
+    lfoStrengthAttachment = std::make_unique<SliderAttachment>(state, "LFO_STRENGTH", lfoStrengthKnob);
+    lfoFreqAttachment     = std::make_unique<SliderAttachment>(state, "LFO_FREQ", lfoFreqKnob);
+
+    // Display text as the WebView editor shows it (set after the
+    // attachments, which install the parameters' own text functions)
+    gainKnob.textFromValueFunction = [](double value) { return juce::String(juce::roundToInt(value * 100.0)); };
+    gainKnob.valueFromTextFunction = [](const juce::String& value) { return value.getDoubleValue() / 100.0; };
+    gainKnob.setTextValueSuffix(" %");
+
+    panKnob.textFromValueFunction = [](double value) {
+        const int percent = juce::roundToInt(value);
+        if (percent == 0)
+            return juce::String("C");
+        return juce::String(std::abs(percent)) + (percent < 0 ? " % L" : " % R");
+    };
+    panKnob.valueFromTextFunction = [](const juce::String& value) {
+        const double amount = std::abs(value.getDoubleValue());
+        return value.containsIgnoreCase("L") ? -amount : amount;
+    };
+
+    driveKnob.setTextValueSuffix(" %");
+    lfoStrengthKnob.setTextValueSuffix(" %");
+    lfoFreqKnob.setTextValueSuffix(" Hz");
+
+    for (auto* knob : { &gainKnob, &panKnob, &driveKnob, &lfoStrengthKnob, &lfoFreqKnob })
+        knob->updateText();
+
+    // ── Section toggles ──────────────────────────────────────────────
+    addAndMakeVisible(satEnabledButton);
+    addAndMakeVisible(lfoEnabledButton);
+
+    satEnabledAttachment = std::make_unique<ButtonAttachment>(state, "SAT_ENABLED", satEnabledButton);
+    lfoEnabledAttachment = std::make_unique<ButtonAttachment>(state, "LFO_ENABLED", lfoEnabledButton);
+
+    // Host automation changes them too, so follow their state, not clicks
+    satEnabledButton.onStateChange = [this] { updateSectionStates(); };
+    lfoEnabledButton.onStateChange = [this] { updateSectionStates(); };
+
+    // ── Saturation mode ──────────────────────────────────────────────
+    // One button per curve; clicking the active one turns saturation Off,
+    // as in the WebView editor
+    for (int index = 0; index < kNumSatModes; ++index)
+    {
+        auto& button = satModeButtons[(size_t) index];
+        const int mode = index + 1;
+
+        button.setButtonText(satModeNames[index]);
+        button.setConnectedEdges((index > 0 ? juce::Button::ConnectedOnLeft : 0)
+                                 | (index < kNumSatModes - 1 ? juce::Button::ConnectedOnRight : 0));
+        button.onClick = [this, mode] {
+            satModeAttachment->setValueAsCompleteGesture(currentSatMode == mode ? 0.0f : (float) mode);
+        };
+        addAndMakeVisible(button);
+    }
+
+    satModeAttachment = std::make_unique<EnzoGainUI::PolledAttachment>(
+        *state.getParameter("SAT_MODE"),
+        [this](float value) { updateModeButtons(juce::roundToInt(value)); }
+    );
+    satModeAttachment->sendInitialUpdate();
+
+    // ── Quality and oversampling ─────────────────────────────────────
+    satQualityBox.addItemList(satQualityNames, 1);
+    osFactorBox.addItemList(osFactorNames, 1);
+    osFilterBox.addItemList(osFilterNames, 1);
+
+    satQualityBox.setTooltip("Saturation quality");
+    osFactorBox.setTooltip("Oversampling");
+    osFilterBox.setTooltip("Oversampling filter: minimum-phase IIR or linear-phase FIR");
+
+    for (auto* box : { &satQualityBox, &osFactorBox, &osFilterBox })
+        addAndMakeVisible(box);
+
+    satQualityAttachment = std::make_unique<ComboBoxAttachment>(state, "SAT_QUALITY", satQualityBox);
+    osFactorAttachment   = std::make_unique<ComboBoxAttachment>(state, "OS_FACTOR", osFactorBox);
+    osFilterAttachment   = std::make_unique<ComboBoxAttachment>(state, "OS_FILTER", osFilterBox);
+
+    // The filter only matters while oversampling
+    osFactorBox.onChange = [this] { updateSectionStates(); };
+
+    // ── Editor switch ────────────────────────────────────────────────
+    // The editor host swaps this editor out asynchronously
+    webModeButton.onClick = [this] { processorRef.setEditorMode(EnzoGainAudioProcessor::EditorMode::web); };
+    addAndMakeVisible(webModeButton);
+
+    updateSectionStates();
+
+    setSize(kWidth, kHeight);
+    setResizable(false, false);
+
+    startTimerHz(kRefreshHz);
+}
+
+EnzoGainNativeEditor::~EnzoGainNativeEditor()
+{
+    stopTimer();
+    setLookAndFeel(nullptr);
+}
+
+void EnzoGainNativeEditor::setUpKnob(juce::Slider& knob, juce::Label& label, const juce::String& name)
+{
+    knob.setSliderStyle(juce::Slider::RotaryHorizontalVerticalDrag);
+    knob.setTextBoxStyle(juce::Slider::TextBoxBelow, false, 72, 18);
+    addAndMakeVisible(knob);
+
+    label.setText(name, juce::dontSendNotification);
+    label.setJustificationType(juce::Justification::centred);
+    label.setFont(juce::FontOptions(11.0f));
+    label.attachToComponent(&knob, false);
+}
+
+void EnzoGainNativeEditor::updateModeButtons(int mode)
+{
+    currentSatMode = mode;
+
+    for (int index = 0; index < kNumSatModes; ++index)
+        satModeButtons[(size_t) index].setToggleState(index + 1 == mode, juce::dontSendNotification);
+}
+
+void EnzoGainNativeEditor::timerCallback()
+{
+    for (auto* attachment : std::initializer_list<EnzoGainUI::PolledAttachment*> {
+             gainAttachment.get(), panAttachment.get(), driveAttachment.get(),
+             lfoStrengthAttachment.get(), lfoFreqAttachment.get(),
+             satEnabledAttachment.get(), lfoEnabledAttachment.get(), satModeAttachment.get(),
+             satQualityAttachment.get(), osFactorAttachment.get(), osFilterAttachment.get() })
+        attachment->poll();
+}
+
+void EnzoGainNativeEditor::updateSectionStates()
+{
+    // Dimmed rather than disabled: the controls still set up a section
+    // before it is switched on
+    const float satAlpha = satEnabledButton.getToggleState() ? 1.0f : 0.5f;
+    const float lfoAlpha = lfoEnabledButton.getToggleState() ? 1.0f : 0.5f;
+
+    for (auto& button : satModeButtons)
+        button.setAlpha(satAlpha);
+
+    satQualityBox.setAlpha(satAlpha);
+    osFactorBox.setAlpha(satAlpha);
+    osFilterBox.setAlpha(osFactorBox.getSelectedItemIndex() > 0 ? satAlpha : 0.5f * satAlpha);
+    driveKnob.setAlpha(satAlpha);
+    lfoStrengthKnob.setAlpha(lfoAlpha);
+    lfoFreqKnob.setAlpha(lfoAlpha);
+}
+
+//==============================================================================
+// AudioProcessorEditor Overrides
+//==============================================================================
+
+void EnzoGainNativeEditor::paint(juce::Graphics& g)
+{
+    g.setGradientFill(juce::ColourGradient::vertical(backgroundTop, 0.0f, backgroundBottom, (float) getHeight()));
+    g.fillAll();
+
+    g.setColour(accentDark);
+    g.setFont(juce::FontOptions(18.0f, juce::Font::bold));
+    g.drawText("EnzoGain", 12, 0, 200, 36, juce::Justification::centredLeft);
+
+    for (auto area : { mainArea, satArea, lfoArea })
+    {
+        g.setColour(panelFill);
+        g.fillRoundedRectangle(area.toFloat(), 6.0f);
+        g.setColour(panelOutline);
+        g.drawRoundedRectangle(area.toFloat().reduced(0.5f), 6.0f, 1.0f);
+    }
+}
+
+void EnzoGainNativeEditor::paintOverChildren(juce::Graphics& g)
+{
+    juce::ignoreUnused(g);
+
+    if (firstPaintMs > 0.0)
+        return;
+
+    firstPaintMs = juce::Time::getMillisecondCounterHiRes() - openedAtMs;
+
+   #if ENZOGAIN_PROFILING
+    juce::Logger::writeToLog("EnzoGain native editor: first paint " + juce::String(firstPaintMs, 1)
+                             + " ms after opening");
+   #endif
+}
+
+void EnzoGainNativeEditor::resized()
+{
+    auto bounds = getLocalBounds().reduced(8, 0);
+
+    auto header = bounds.removeFromTop(36);
+    webModeButton.setBounds(header.removeFromRight(64).withSizeKeepingCentre(64, 22));
+
+    // Gain in the middle, pan to its right
+    mainArea = bounds.removeFromTop(164);
+    {
+        auto area = mainArea.reduced(8);
+        area.removeFromTop(16);   // knob labels sit above their knobs
+        gainKnob.setBounds(area.withSizeKeepingCentre(120, area.getHeight()));
+        panKnob.setBounds(area.removeFromRight(84).withSizeKeepingCentre(84, 96));
+    }
+
+    bounds.removeFromTop(8);
+
+    // Saturation: toggle and mode buttons on the left, drive on the right,
+    // quality and oversampling along the bottom
+    satArea = bounds.removeFromTop(132);
+    {
+        auto area = satArea.reduced(8, 4);
+
+        auto options = area.removeFromBottom(26);
+        const int optionWidth = (options.getWidth() - 8) / 3;
+        satQualityBox.setBounds(options.removeFromLeft(optionWidth));
+        osFilterBox.setBounds(options.removeFromRight(optionWidth));
+        osFactorBox.setBounds(options.withSizeKeepingCentre(optionWidth, options.getHeight()));
+        area.removeFromBottom(6);
+
+        driveKnob.setBounds(area.removeFromRight(84).withTrimmedTop(16));
+
+        satEnabledButton.setBounds(area.removeFromTop(28).withWidth(120));
+        area.removeFromTop(8);
+
+        auto modes = area.removeFromTop(26);
+        const int buttonWidth = modes.getWidth() / kNumSatModes;
+
+        for (auto& button : satModeButtons)
+            button.setBounds(modes.removeFromLeft(buttonWidth));
+    }
+
+    bounds.removeFromTop(8);
+
+    // LFO: toggle on top, strength and frequency side by side
+    lfoArea = bounds.removeFromTop(128);
+    {
+        auto area = lfoArea.reduced(8, 4);
+        lfoEnabledButton.setBounds(area.removeFromTop(24).withWidth(80));
+        area.removeFromTop(14);
+
+        auto left = area.removeFromLeft(area.getWidth() / 2);
+        lfoStrengthKnob.setBounds(left.withSizeKeepingCentre(100, area.getHeight()));
+        lfoFreqKnob.setBounds(area.withSizeKeepingCentre(100, area.getHeight()));
+    }
+}
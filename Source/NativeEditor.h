@@ -0,0 +1,91 @@
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+#include <juce_audio_processors/juce_audio_processors.h>
+#include "PluginProcessor.h"
+#include "ui/PolledAttachments.h"
+
+/**
+ * Lightweight native editor for EnzoGain
+ *
+ * The same controls as the WebView editor (gain, pan, saturation mode,
+ * drive, quality and oversampling, section toggles, LFO strength and
+ * rate) built from plain JUCE
+ * components, for sessions with many instances open: no browser process,
+ * no page to load, no metering or analyser.  Selected through
+ * EnzoGainAudioProcessor::setEditorMode(); hosted by EnzoGainEditorHost.
+ *
+ * Controls follow the parameters through EnzoGainUI polled attachments,
+ * read once per UI tick, so host automation on the audio thread never
+ * reaches the editor.
+ *
+ * Attachments are declared after the components they drive, so they are
+ * destroyed first.
+ */
+
+class EnzoGainNativeEditor : public juce::AudioProcessorEditor,
+                             private juce::Timer
+{
+public:
+    explicit EnzoGainNativeEditor(EnzoGainAudioProcessor& p);
+    ~EnzoGainNativeEditor() override;
+
+    void paint(juce::Graphics&) override;
+    void paintOverChildren(juce::Graphics&) override;
+    void resized() override;
+
+    /** Milliseconds from construction to the first painted frame; 0 until then. */
+    double getOpenToFirstPaintMs() const noexcept { return firstPaintMs; }
+
+private:
+    void setUpKnob(juce::Slider& knob, juce::Label& label, const juce::String& name);
+    void updateModeButtons(int mode);
+    void updateSectionStates();
+    void timerCallback() override;
+
+    EnzoGainAudioProcessor& processorRef;
+
+    const double openedAtMs = juce::Time::getMillisecondCounterHiRes();
+    double firstPaintMs = 0.0;
+
+    static constexpr int kWidth       = 340;
+    static constexpr int kHeight      = 484;
+    static constexpr int kNumSatModes = 4;   // SAT_MODE choices after "Off"
+    static constexpr int kRefreshHz   = 30;
+
+    // Outlives every child that draws with it
+    juce::LookAndFeel_V4 lookAndFeel;
+
+    juce::TextButton webModeButton { "Web UI" };
+
+    juce::Slider gainKnob, panKnob, driveKnob, lfoStrengthKnob, lfoFreqKnob;
+    juce::Label gainLabel, panLabel, driveLabel, lfoStrengthLabel, lfoFreqLabel;
+
+    juce::ToggleButton satEnabledButton { "Saturation" };
+    juce::ToggleButton lfoEnabledButton { "LFO" };
+    std::array<juce::TextButton, kNumSatModes> satModeButtons;
+    int currentSatMode = 0;
+
+    // SAT_QUALITY, OS_FACTOR, OS_FILTER
+    juce::ComboBox satQualityBox, osFactorBox, osFilterBox;
+
+    juce::Rectangle<int> mainArea, satArea, lfoArea;
+
+    using SliderAttachment = EnzoGainUI::PolledSliderAttachment;
+    using ButtonAttachment = EnzoGainUI::PolledButtonAttachment;
+    using ComboBoxAttachment = EnzoGainUI::PolledComboBoxAttachment;
+
+    std::unique_ptr<SliderAttachment> gainAttachment;
+    std::unique_ptr<SliderAttachment> panAttachment;
+    std::unique_ptr<SliderAttachment> driveAttachment;
+    std::unique_ptr<SliderAttachment> lfoStrengthAttachment;
+    std::unique_ptr<SliderAttachment> lfoFreqAttachment;
+    std::unique_ptr<ButtonAttachment> satEnabledAttachment;
+    std::unique_ptr<ButtonAttachment> lfoEnabledAttachment;
+    std::unique_ptr<EnzoGainUI::PolledAttachment> satModeAttachment;
+    std::unique_ptr<ComboBoxAttachment> satQualityAttachment;
+    std::unique_ptr<ComboBoxAttachment> osFactorAttachment;
+    std::unique_ptr<ComboBoxAttachment> osFilterAttachment;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(EnzoGainNativeEditor)
+};
@@ -1,24 +1,20 @@
 #include "PluginEditor.h"
-#include "BinaryData.h"
+#include "ui/UIResources.h"
 
 //==============================================================================
 // Constructor - CRITICAL: Initialize in correct order
 //==============================================================================
 
 EnzoGainAudioProcessorEditor::EnzoGainAudioProcessorEditor(EnzoGainAudioProcessor& p)
-    : AudioProcessorEditor(&p), processorRef(p)
-{
-    // STEP 1: CREATE RELAYS (before WebView!)
-    gainRelay = std::make_unique<juce::WebSliderRelay>("GAIN");
-    panRelay = std::make_unique<juce::WebSliderRelay>("PAN");
-    lfoStrengthRelay = std::make_unique<juce::WebSliderRelay>("LFO_STRENGTH");
-    lfoFreqRelay = std::make_unique<juce::WebSliderRelay>("LFO_FREQ");
-    lfoEnabledRelay = std::make_unique<juce::WebToggleButtonRelay>("LFO_ENABLED");
-    satModeRelay = std::make_unique<juce::WebSliderRelay>("SAT_MODE");
-    satEnabledRelay = std::make_unique<juce::WebToggleButtonRelay>("SAT_ENABLED");
-    satDriveRelay = std::make_unique<juce::WebSliderRelay>("SAT_DRIVE");
-
-    // STEP 2: CREATE WEBVIEW (with relay options)
+    : AudioProcessorEditor(&p), processorRef(p),
+      analyser(p.getAnalyserOutputRing(), p.getAnalyserInputRing()),
+      parameterBridge(p.parameters, { "GAIN", "PAN", "LFO_STRENGTH", "LFO_FREQ",
+                                      "LFO_ENABLED", "SAT_MODE", "SAT_ENABLED", "SAT_DRIVE",
+                                      "SAT_QUALITY", "OS_FACTOR", "OS_FILTER" })
+{
+    // CREATE WEBVIEW (after the bridge, which its callbacks use)
+    // The page starts from the values in its initialisation data, then
+    // asks for a fresh snapshot once its listeners are in place.
     webView = std::make_unique<juce::WebBrowserComponent>(
         juce::WebBrowserComponent::Options{}
             .withNativeIntegrationEnabled()
@@ -26,76 +22,44 @@ EnzoGainAudioProcessorEditor::EnzoGainAudioProcessorEditor(EnzoGainAudioProcesso
                 return getResource(url);
             })
             .withKeepPageLoadedWhenBrowserIsHidden()
-            .withOptionsFrom(*gainRelay)
-            .withOptionsFrom(*panRelay)
-            .withOptionsFrom(*lfoStrengthRelay)
-            .withOptionsFrom(*lfoFreqRelay)
-            .withOptionsFrom(*lfoEnabledRelay)
-            .withOptionsFrom(*satModeRelay)
-            .withOptionsFrom(*satEnabledRelay)
-            .withOptionsFrom(*satDriveRelay)
-    );
-
-    // STEP 3: CREATE PARAMETER ATTACHMENTS (after WebView!)
-    gainAttachment = std::make_unique<juce::WebSliderParameterAttachment>(
-        *processorRef.parameters.getParameter("GAIN"),
-        *gainRelay,
-        nullptr
-    );
-
-    panAttachment = std::make_unique<juce::WebSliderParameterAttachment>(
-        *processorRef.parameters.getParameter("PAN"),
-        *panRelay,
-        nullptr
-    );
-
-    lfoStrengthAttachment = std::make_unique<juce::WebSliderParameterAttachment>(
-        *processorRef.parameters.getParameter("LFO_STRENGTH"),
-        *lfoStrengthRelay,
-        nullptr
-    );
-
-    lfoFreqAttachment = std::make_unique<juce::WebSliderParameterAttachment>(
-        *processorRef.parameters.getParameter("LFO_FREQ"),
-        *lfoFreqRelay,
-        nullptr
-    );
-
-    lfoEnabledAttachment = std::make_unique<juce::WebToggleButtonParameterAttachment>(
-        *processorRef.parameters.getParameter("LFO_ENABLED"),
-        *lfoEnabledRelay,
-        nullptr
-    );
-
-    satModeAttachment = std::make_unique<juce::WebSliderParameterAttachment>(
-        *processorRef.parameters.getParameter("SAT_MODE"),
-        *satModeRelay,
-        nullptr
-    );
-
-    satEnabledAttachment = std::make_unique<juce::WebToggleButtonParameterAttachment>(
-        *processorRef.parameters.getParameter("SAT_ENABLED"),
-        *satEnabledRelay,
-        nullptr
-    );
-
-    satDriveAttachment = std::make_unique<juce::WebSliderParameterAttachment>(
-        *processorRef.parameters.getParameter("SAT_DRIVE"),
-        *satDriveRelay,
-        nullptr
+            .withInitialisationData("parameters", parameterBridge.getSnapshot(false))
+            .withNativeFunction("getParameters", [this](const juce::Array<juce::var>&,
+                                                        juce::WebBrowserComponent::NativeFunctionCompletion completion) {
+                completion(parameterBridge.getSnapshot(true));
+            })
+            .withEventListener("parameters", [this](const juce::var& batch) {
+                parameterBridge.applyBatch(batch);
+            })
+            .withNativeFunction("setAnalyserInputTap", [this](const juce::Array<juce::var>& args,
+                                                              juce::WebBrowserComponent::NativeFunctionCompletion completion) {
+                analyserInputTap = args.size() > 0 && static_cast<bool>(args[0]);
+                if (isTimerRunning())
+                {
+                    processorRef.setAnalyserTaps(true, analyserInputTap);
+                    analyser.setInputEnabled(analyserInputTap);
+                }
+                completion(juce::var(analyserInputTap));
+            })
+            .withNativeFunction("setEditorMode", [this](const juce::Array<juce::var>& args,
+                                                        juce::WebBrowserComponent::NativeFunctionCompletion completion) {
+                // The editor host swaps this editor out asynchronously
+                if (args.size() > 0 && args[0].toString() == "native")
+                    processorRef.setEditorMode(EnzoGainAudioProcessor::EditorMode::native);
+                completion(juce::var());
+            })
+            .withNativeFunction("reportFirstPaint", [this](const juce::Array<juce::var>& args,
+                                                           juce::WebBrowserComponent::NativeFunctionCompletion completion) {
+                reportOpenTiming(args.size() > 0 ? static_cast<double>(args[0]) : 0.0);
+                completion(juce::var());
+            })
     );
 
-    // Listen for LFO_ENABLED changes to resize the window
-    processorRef.parameters.addParameterListener("LFO_ENABLED", this);
-
     // Navigate to root (loads index.html via resource provider)
     webView->goToURL(juce::WebBrowserComponent::getResourceProviderRoot());
 
     addAndMakeVisible(*webView);
 
-    // Set initial size based on LFO_ENABLED state
-    bool lfoOn = processorRef.parameters.getRawParameterValue("LFO_ENABLED")->load() >= 0.5f;
-    setSize(kWidth, lfoOn ? kExpandedHeight : kCollapsedHeight);
+    updateHeight();
     setResizable(false, false);
 }
 
@@ -105,11 +69,16 @@ EnzoGainAudioProcessorEditor::EnzoGainAudioProcessorEditor(EnzoGainAudioProcesso
 
 EnzoGainAudioProcessorEditor::~EnzoGainAudioProcessorEditor()
 {
-    processorRef.parameters.removeParameterListener("LFO_ENABLED", this);
+    stopTimer();
+    analyser.stop();
+    processorRef.setMeteringEnabled(false);
+    processorRef.setAnalyserTaps(false, false);
+   #if ENZOGAIN_PROFILING
+    reportBridgeStats();
+   #endif
     // Members automatically destroyed in reverse order:
-    // 1. Attachments (stop calling evaluateJavascript)
-    // 2. webView (safe, attachments are gone)
-    // 3. Relays (safe, nothing using them)
+    // 1. webView (no more calls into the bridge)
+    // 2. parameterBridge (safe, nothing using it)
 }
 
 //==============================================================================
@@ -126,70 +95,232 @@ void EnzoGainAudioProcessorEditor::resized()
     webView->setBounds(getLocalBounds());
 }
 
-void EnzoGainAudioProcessorEditor::parameterChanged(const juce::String& parameterID, float newValue)
+void EnzoGainAudioProcessorEditor::visibilityChanged()
 {
-    if (parameterID == "LFO_ENABLED")
-    {
-        bool enabled = newValue >= 0.5f;
-        // Must resize on the message thread — use SafePointer to avoid dangling reference
-        juce::Component::SafePointer<EnzoGainAudioProcessorEditor> safeThis(this);
-        juce::MessageManager::callAsync([safeThis, enabled]() {
-            if (safeThis != nullptr)
-                safeThis->setSize(kWidth, enabled ? kExpandedHeight : kCollapsedHeight);
-        });
-    }
+    updateLiveViewState();
+}
+
+void EnzoGainAudioProcessorEditor::parentHierarchyChanged()
+{
+    updateLiveViewState();
 }
 
 //==============================================================================
-// Resource Provider
+// Metering and analyser
 //==============================================================================
 
-std::optional<juce::WebBrowserComponent::Resource> EnzoGainAudioProcessorEditor::getResource(
-    const juce::String& url
-)
+void EnzoGainAudioProcessorEditor::updateLiveViewState()
 {
-    auto makeVector = [](const char* data, int size) {
-        return std::vector<std::byte>(
-            reinterpret_cast<const std::byte*>(data),
-            reinterpret_cast<const std::byte*>(data) + size
-        );
-    };
+    const bool showing = isShowing();
 
-    if (url == "/" || url == "/index.html") {
-        return juce::WebBrowserComponent::Resource {
-            makeVector(BinaryData::index_html, BinaryData::index_htmlSize),
-            juce::String("text/html")
-        };
-    }
+    if (showing == isTimerRunning())
+        return;
 
-    if (url == "/js/juce/index.js") {
-        return juce::WebBrowserComponent::Resource {
-            makeVector(BinaryData::index_js, BinaryData::index_jsSize),
-            juce::String("text/javascript")
-        };
-    }
+    processorRef.setMeteringEnabled(showing);
+    processorRef.setAnalyserTaps(showing, showing && analyserInputTap);
+
+    if (showing)
+    {
+        // Drop frames left over from before the editor was hidden
+        while (processorRef.popMeterFrames(meterFrames.data(), (int) meterFrames.size()) > 0) {}
 
-    if (url == "/js/juce/check_native_interop.js") {
-        return juce::WebBrowserComponent::Resource {
-            makeVector(BinaryData::check_native_interop_js, BinaryData::check_native_interop_jsSize),
-            juce::String("text/javascript")
-        };
+        analyser.start(kMeterRefreshHz, analyserInputTap);
+        startTimerHz(kMeterRefreshHz);
     }
+    else
+    {
+        stopTimer();
+        analyser.stop();
+    }
+}
+
+void EnzoGainAudioProcessorEditor::timerCallback()
+{
+    updateHeight();
+    emitParameterChanges();
+    emitMeterFrames();
+    emitAnalyserFrame();
+    emitProfileSummary();
+}
+
+void EnzoGainAudioProcessorEditor::emitParameterChanges()
+{
+    // Everything that changed since the last tick, as one event
+    auto changes = parameterBridge.takeChanges();
+
+    if (! changes.isVoid())
+        webView->emitEventIfBrowserIsVisible("parameters", changes);
+}
+
+void EnzoGainAudioProcessorEditor::emitMeterFrames()
+{
+    const int numFrames = processorRef.popMeterFrames(meterFrames.data(), (int) meterFrames.size());
+
+    if (numFrames == 0)
+        return;
+
+    // One event per tick carrying every frame since the last one
+    juce::Array<juce::var> batch;
+    batch.ensureStorageAllocated(numFrames);
+
+    for (int index = 0; index < numFrames; ++index)
+    {
+        const auto& frame = meterFrames[(size_t) index];
+        juce::Array<juce::var> peak, rms;
 
-    if (url == "/logo.png") {
-        return juce::WebBrowserComponent::Resource {
-            makeVector(BinaryData::logo_png, BinaryData::logo_pngSize),
-            juce::String("image/png")
-        };
+        for (int channel = 0; channel < frame.numChannels; ++channel)
+        {
+            peak.add(frame.peak[channel]);
+            rms.add(frame.rms[channel]);
+        }
+
+        juce::DynamicObject::Ptr object = new juce::DynamicObject();
+        object->setProperty("peak", peak);
+        object->setProperty("rms", rms);
+        object->setProperty("satComp", frame.satComp);
+        object->setProperty("gain", frame.effectiveGain);
+        batch.add(juce::var(object.get()));
     }
 
-    if (url == "/spicy.png") {
-        return juce::WebBrowserComponent::Resource {
-            makeVector(BinaryData::spicy_png, BinaryData::spicy_pngSize),
-            juce::String("image/png")
-        };
+    webView->emitEventIfBrowserIsVisible("meters", batch);
+}
+
+void EnzoGainAudioProcessorEditor::emitAnalyserFrame()
+{
+    if (! analyser.getLatestFrame(analyserFrame))
+        return;
+
+    // Bands are sent in whole dB; the canvas cannot show finer steps
+    auto toArray = [](const float* values, int size, float scale) {
+        juce::Array<juce::var> array;
+        array.ensureStorageAllocated(size);
+
+        for (int i = 0; i < size; ++i)
+            array.add(std::round(values[i] * scale) / scale);
+
+        return array;
+    };
+
+    using Frame = EnzoGainDSP::AnalyserFrame;
+
+    juce::DynamicObject::Ptr object = new juce::DynamicObject();
+    object->setProperty("output", toArray(analyserFrame.output, Frame::numBands, 1.0f));
+    object->setProperty("scope", toArray(analyserFrame.scope, Frame::numScopePoints, 1000.0f));
+    object->setProperty("minHz", analyserFrame.minHz);
+    object->setProperty("maxHz", analyserFrame.maxHz);
+
+    if (analyserFrame.hasInput)
+        object->setProperty("input", toArray(analyserFrame.input, Frame::numBands, 1.0f));
+
+    webView->emitEventIfBrowserIsVisible("spectrum", juce::var(object.get()));
+}
+
+void EnzoGainAudioProcessorEditor::emitProfileSummary()
+{
+    EnzoGainDSP::ProfileSummary summary;
+
+    if (! processorRef.getProfileSummary(summary) || summary.sequence == lastProfileSequence)
+        return;
+
+    lastProfileSequence = summary.sequence;
+
+    // Microseconds to 0.01, headroom to 0.1 %
+    auto round = [](float value, float scale) { return std::round(value * scale) / scale; };
+
+    juce::Array<juce::var> stages;
+
+    for (int stage = 0; stage < EnzoGainDSP::numProfileStages; ++stage)
+    {
+        juce::DynamicObject::Ptr row = new juce::DynamicObject();
+        row->setProperty("name", EnzoGainDSP::getStageName(stage));
+        row->setProperty("mean", round(summary.meanMicros[stage], 100.0f));
+        row->setProperty("p99", round(summary.p99Micros[stage], 100.0f));
+        stages.add(juce::var(row.get()));
     }
 
+    juce::DynamicObject::Ptr object = new juce::DynamicObject();
+    object->setProperty("stages", stages);
+    object->setProperty("blockMean", round(summary.meanBlockMicros, 100.0f));
+    object->setProperty("blockP99", round(summary.p99BlockMicros, 100.0f));
+    object->setProperty("headroomMean", round(summary.meanHeadroom, 1000.0f));
+    object->setProperty("headroomMin", round(summary.minHeadroom, 1000.0f));
+    object->setProperty("blocks", summary.numBlocks);
+    object->setProperty("nonRealtime", summary.numNonRealtime);
+    object->setProperty("trace", processorRef.getProfileTraceFile().getFullPathName());
+
+    webView->emitEventIfBrowserIsVisible("profile", juce::var(object.get()));
+}
+
+void EnzoGainAudioProcessorEditor::updateHeight()
+{
+    // Read here rather than from a parameter listener: host automation
+    // changes LFO_ENABLED on the audio thread
+    const bool lfoOn = processorRef.parameters.getRawParameterValue("LFO_ENABLED")->load() >= 0.5f;
+    const int height = lfoOn ? kExpandedHeight : kCollapsedHeight;
+
+    if (height != getHeight())
+        setSize(kWidth, height);
+}
+
+//==============================================================================
+// Startup timing
+//==============================================================================
+
+void EnzoGainAudioProcessorEditor::reportOpenTiming(double pageMilliseconds)
+{
+    if (firstPaintMs > 0.0)
+        return;
+
+    firstPaintMs = juce::Time::getMillisecondCounterHiRes() - openedAtMs;
+
+   #if ENZOGAIN_PROFILING
+    const double requestedMs = pageRequestedMs.load();
+    const double toRequestMs = requestedMs > 0.0 ? requestedMs - openedAtMs : 0.0;
+
+    juce::Logger::writeToLog("EnzoGain editor: first paint " + juce::String(firstPaintMs, 1)
+                             + " ms after opening (page requested at " + juce::String(toRequestMs, 1)
+                             + " ms, " + juce::String(pageMilliseconds, 1) + " ms inside the page)");
+   #else
+    juce::ignoreUnused(pageMilliseconds);
+   #endif
+}
+
+#if ENZOGAIN_PROFILING
+void EnzoGainAudioProcessorEditor::reportBridgeStats() const
+{
+    const auto stats = parameterBridge.getStats();
+
+    // The bridge is notified of the page's own edits too; those are never sent back
+    const auto hostChanges = stats.hostChanges - stats.pageValuesApplied;
+
+    if (hostChanges <= 0 && stats.pageChanges == 0)
+        return;
+
+    juce::Logger::writeToLog("EnzoGain parameter bridge: " + juce::String(hostChanges) + " host changes sent as "
+                             + juce::String(stats.hostEvents) + " events (" + juce::String(stats.hostValuesSent)
+                             + " values), " + juce::String(stats.pageChanges) + " page edits sent as "
+                             + juce::String(stats.pageBatches) + " batches; "
+                             + juce::String(juce::jmax((juce::int64) 0, hostChanges - stats.hostEvents)
+                                            + juce::jmax((juce::int64) 0, stats.pageChanges - stats.pageBatches))
+                             + " messages saved");
+}
+#endif
+
+//==============================================================================
+// Resource Provider
+//==============================================================================
+
+std::optional<juce::WebBrowserComponent::Resource> EnzoGainAudioProcessorEditor::getResource(
+    const juce::String& url
+)
+{
+    // Stamped once: the first request for the page itself
+    if (pageRequestedMs.load() == 0.0 && (url == "/" || url == "/index.html"))
+        pageRequestedMs = juce::Time::getMillisecondCounterHiRes();
+
+    if (auto resource = EnzoGainUI::ResourceTable::get().makeResource(url))
+        return resource;
+
     // Return empty resource for any unknown URL (e.g. /favicon.ico)
     // Prevents "missing file" errors in FL Studio and other hosts
     return juce::WebBrowserComponent::Resource {
@@ -2,20 +2,25 @@
 
 #include <juce_gui_extra/juce_gui_extra.h>
 #include "PluginProcessor.h"
+#include "dsp/SpectrumAnalyser.h"
+#include "ui/ParameterBridge.h"
 
 /**
  * WebView-based Plugin Editor for EnzoGain
  *
+ * Parameters reach the page through EnzoGainUI::ParameterBridge: one
+ * batched event per UI tick towards the page, one batch per animation
+ * frame back.
+ *
  * CRITICAL: Member order prevents release build crashes.
  *
  * Destruction order (reverse of declaration):
- * 1. Attachment destroyed FIRST (stops using relay and WebView)
- * 2. WebView destroyed SECOND (safe, attachment is gone)
- * 3. Relay destroyed LAST (safe, nothing using it)
+ * 1. WebView destroyed FIRST (no more native calls into the bridge)
+ * 2. Bridge destroyed LAST (ends any gesture the page left open)
  */
 
 class EnzoGainAudioProcessorEditor : public juce::AudioProcessorEditor,
-                                    private juce::AudioProcessorValueTreeState::Listener
+                                    private juce::Timer
 {
 public:
     explicit EnzoGainAudioProcessorEditor(EnzoGainAudioProcessor& p);
@@ -23,46 +28,70 @@ public:
 
     void paint(juce::Graphics&) override;
     void resized() override;
+    void visibilityChanged() override;
+    void parentHierarchyChanged() override;
+
+    /** Milliseconds from construction to the page's first painted frame; 0 until then. */
+    double getOpenToFirstPaintMs() const noexcept { return firstPaintMs; }
 
 private:
-    void parameterChanged(const juce::String& parameterID, float newValue) override;
+    // Collapsed or expanded with LFO_ENABLED; checked once per UI tick
+    void updateHeight();
+
+    // Metering and analyser: run only while the editor is on screen
+    void updateLiveViewState();
+    void timerCallback() override;
+    void emitParameterChanges();
+    void emitMeterFrames();
+    void emitAnalyserFrame();
+    void emitProfileSummary();
 
+    // Embedded UI files, from the generated EnzoGainUI::ResourceTable
     std::optional<juce::WebBrowserComponent::Resource> getResource(
         const juce::String& url
     );
 
+    // Records open-to-first-paint time when the page reports its first
+    // frame; ENZOGAIN_PROFILING builds also log it
+    void reportOpenTiming(double pageMilliseconds);
+
+   #if ENZOGAIN_PROFILING
+    // Logs how much parameter traffic the bridge batched away
+    void reportBridgeStats() const;
+   #endif
+
     EnzoGainAudioProcessor& processorRef;
 
+    // Startup timing: constructor, first page request, first painted frame
+    const double openedAtMs = juce::Time::getMillisecondCounterHiRes();
+    std::atomic<double> pageRequestedMs { 0.0 };
+    double firstPaintMs = 0.0;
+
     static constexpr int kWidth           = 340;
-    static constexpr int kCollapsedHeight = 350;
-    static constexpr int kExpandedHeight  = 545;
+    static constexpr int kCollapsedHeight = 434;
+    static constexpr int kExpandedHeight  = 629;
+    static constexpr int kMeterRefreshHz  = 30;
+
+    // Frames popped per tick (reused, so a tick never allocates for them)
+    std::array<EnzoGainDSP::MeterFrame, EnzoGainDSP::MeterFifo::capacity> meterFrames;
+
+    // FFT / scope analysis of the processor's snapshot rings, on its own thread
+    EnzoGainDSP::SpectrumAnalyser analyser;
+    EnzoGainDSP::AnalyserFrame analyserFrame {};
+    bool analyserInputTap = false;   // pre-saturation overlay, toggled from the UI
+
+    // Stage timings of ENZOGAIN_PROFILING builds; sent when the dumper updates them
+    int lastProfileSequence = 0;
 
     // ========================================================================
-    // CRITICAL MEMBER DECLARATION ORDER: Relays -> WebView -> Attachments
+    // CRITICAL MEMBER DECLARATION ORDER: Bridge -> WebView
     // ========================================================================
 
-    // 1. RELAYS FIRST (created first, destroyed last)
-    std::unique_ptr<juce::WebSliderRelay> gainRelay;
-    std::unique_ptr<juce::WebSliderRelay> panRelay;
-    std::unique_ptr<juce::WebSliderRelay> lfoStrengthRelay;
-    std::unique_ptr<juce::WebSliderRelay> lfoFreqRelay;
-    std::unique_ptr<juce::WebToggleButtonRelay> lfoEnabledRelay;
-    std::unique_ptr<juce::WebSliderRelay> satModeRelay;
-    std::unique_ptr<juce::WebToggleButtonRelay> satEnabledRelay;
-    std::unique_ptr<juce::WebSliderRelay> satDriveRelay;
-
-    // 2. WEBVIEW SECOND (created after relays, destroyed before relays)
-    std::unique_ptr<juce::WebBrowserComponent> webView;
+    // 1. BRIDGE FIRST (created first, destroyed last)
+    EnzoGainUI::ParameterBridge parameterBridge;
 
-    // 3. PARAMETER ATTACHMENTS LAST (created last, destroyed first)
-    std::unique_ptr<juce::WebSliderParameterAttachment> gainAttachment;
-    std::unique_ptr<juce::WebSliderParameterAttachment> panAttachment;
-    std::unique_ptr<juce::WebSliderParameterAttachment> lfoStrengthAttachment;
-    std::unique_ptr<juce::WebSliderParameterAttachment> lfoFreqAttachment;
-    std::unique_ptr<juce::WebToggleButtonParameterAttachment> lfoEnabledAttachment;
-    std::unique_ptr<juce::WebSliderParameterAttachment> satModeAttachment;
-    std::unique_ptr<juce::WebToggleButtonParameterAttachment> satEnabledAttachment;
-    std::unique_ptr<juce::WebSliderParameterAttachment> satDriveAttachment;
+    // 2. WEBVIEW LAST (its native functions call into the bridge)
+    std::unique_ptr<juce::WebBrowserComponent> webView;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(EnzoGainAudioProcessorEditor)
 };
@@ -1,5 +1,10 @@
 #include "PluginProcessor.h"
-#include "PluginEditor.h"
+
+#if ! ENZOGAIN_HEADLESS
+ #include "EditorHost.h"
+#endif
+
+const juce::Identifier EnzoGainAudioProcessor::editorModeProperty { "editorMode" };
 
 juce::AudioProcessorValueTreeState::ParameterLayout EnzoGainAudioProcessor::createParameterLayout()
 {
@@ -72,210 +77,882 @@ juce::AudioProcessorValueTreeState::ParameterLayout EnzoGainAudioProcessor::crea
         "%"
     ));
 
+    // SAT_QUALITY - Waveshaper implementation (Fast approximations, Reference exact
+    //               curves, first/second-order antiderivative anti-aliasing)
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { "SAT_QUALITY", 2 },
+        "Saturation Quality",
+        juce::StringArray { "Fast", "Reference", "ADAA 1st", "ADAA 2nd" },
+        0
+    ));
+
+    // OS_FACTOR - Oversampling around the saturation stage (1x, 2x, 4x, 8x)
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { "OS_FACTOR", 2 },
+        "Oversampling",
+        juce::StringArray { "1x", "2x", "4x", "8x" },
+        0
+    ));
+
+    // OS_FILTER - Oversampling filter (IIR minimum latency, FIR linear phase)
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { "OS_FILTER", 2 },
+        "Oversampling Filter",
+        juce::StringArray { "Min Phase (IIR)", "Linear Phase (FIR)" },
+        0
+    ));
+
     return layout;
 }
 
+const char* const EnzoGainAudioProcessor::parameterIDs[numParameters] =
+{
+    "GAIN", "PAN", "SAT_DRIVE", "LFO_STRENGTH", "LFO_FREQ",
+    "LFO_ENABLED", "SAT_MODE", "SAT_ENABLED", "SAT_QUALITY", "OS_FACTOR", "OS_FILTER"
+};
+
 EnzoGainAudioProcessor::EnzoGainAudioProcessor()
     : AudioProcessor(BusesProperties()
                         .withInput("Input", juce::AudioChannelSet::stereo(), true)
                         .withOutput("Output", juce::AudioChannelSet::stereo(), true))
     , parameters(*this, nullptr, "Parameters", createParameterLayout())
 {
+    for (int index = 0; index < numParameters; ++index)
+    {
+        parameterValues[index]  = parameters.getRawParameterValue(parameterIDs[index]);
+        parameterObjects[index] = parameters.getParameter(parameterIDs[index]);
+        parameterHashes[index]  = EnzoGainState::hashParameterID(parameterIDs[index]);
+        jassert(parameterValues[index] != nullptr && parameterObjects[index] != nullptr);
+
+        // Saved states key values by this hash: a new ID must not collide
+        for (int other = 0; other < index; ++other)
+            jassert(parameterHashes[other] != parameterHashes[index]);
+    }
+
+    for (int lane = 0; lane < numAutomationLanes; ++lane)
+        hot.automationValues[lane] = hot.lastParameterValues[lane] = parameterValues[lane]->load();
+
+    startTimerHz(30);   // latency reporting, see timerCallback
+}
+
+EnzoGainAudioProcessor::ParameterSnapshot EnzoGainAudioProcessor::readParameters() const noexcept
+{
+    ParameterSnapshot snapshot;
+
+    for (int lane = 0; lane < numAutomationLanes; ++lane)
+        snapshot.automatable[lane] = parameterValues[lane]->load(std::memory_order_relaxed);
+
+    snapshot.lfoEnabled = parameterValues[lfoEnabledParam]->load(std::memory_order_relaxed) >= 0.5f;
+    snapshot.satMode    = static_cast<int>(parameterValues[satModeParam]->load(std::memory_order_relaxed));
+    snapshot.satEnabled = parameterValues[satEnabledParam]->load(std::memory_order_relaxed) >= 0.5f;
+    snapshot.satQuality = static_cast<EnzoGainDSP::SaturationQuality>(
+                              static_cast<int>(parameterValues[satQualityParam]->load(std::memory_order_relaxed)));
+    snapshot.osFactor   = static_cast<int>(parameterValues[osFactorParam]->load(std::memory_order_relaxed));
+    snapshot.osFilter   = static_cast<int>(parameterValues[osFilterParam]->load(std::memory_order_relaxed));
+    return snapshot;
 }
 
 EnzoGainAudioProcessor::~EnzoGainAudioProcessor()
 {
+    stopTimer();
 }
 
 void EnzoGainAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
-    juce::ignoreUnused(samplesPerBlock);
-
     currentSampleRate = sampleRate;
 
+    // Hosts that exceed samplesPerBlock are rendered in chunks of this
+    // size, so processBlock never allocates
+    hot.maxBlockSize = juce::jmax(1, samplesPerBlock);
+
+    hot.lfo.prepare(sampleRate);
+
+    const int numChannels = juce::jmax(getTotalNumInputChannels(), getTotalNumOutputChannels());
+
+    // Pan law / envelope linking for the bus layout; every channel it covers
+    // is saturated (the stereo kernels use two wet rows whatever the bus)
+    channelPlan.build(getChannelLayoutOfBus(false, 0));
+    const int numSaturatedChannels = juce::jmax(2, channelPlan.getNumChannels());
+    adaa.assign((size_t) numSaturatedChannels, {});
+
+    hot.wetPathPrimed = false;
+    hot.saturationLatency = -1.0f;   // force updateWetPath to report
+
+    const auto params = readParameters();
+
+    // Only the precision the host will call us with gets buffers
+    if (isUsingDoublePrecision())
+    {
+        doubleLanes.prepare(numChannels, numSaturatedChannels, hot.maxBlockSize);
+        floatLanes.release();
+        updateWetPath<double>(params.osFactor, params.osFilter, params.satQuality);
+    }
+    else
+    {
+        floatLanes.prepare(numChannels, numSaturatedChannels, hot.maxBlockSize);
+        doubleLanes.release();
+        updateWetPath<float>(params.osFactor, params.osFilter, params.satQuality);
+    }
+
+    setLatencySamples(pendingLatencySamples.load(std::memory_order_relaxed));
+
     // Initialize smoothed gain to avoid zipper noise on parameter changes
-    smoothedGain.reset(sampleRate, 0.02);  // 20ms smoothing
-    smoothedGain.setCurrentAndTargetValue(
-        parameters.getRawParameterValue("GAIN")->load()
-    );
+    hot.smoothedGain.reset(sampleRate, 0.02);  // 20ms smoothing
+    hot.smoothedGain.setCurrentAndTargetValue(params.automatable[gainParam]);
 
-    smoothedPan.reset(sampleRate, 0.02);
-    smoothedPan.setCurrentAndTargetValue(
-        parameters.getRawParameterValue("PAN")->load() / 100.0f
-    );
+    hot.smoothedPan.reset(sampleRate, 0.02);
+    hot.smoothedPan.setCurrentAndTargetValue(params.automatable[panParam] / 100.0f);
 
     // Saturation drive smoothing  (50 ms ramp — eliminates zipper/aliasing clicks)
-    smoothedDrive.reset(sampleRate, 0.05);
-    float initDrive = parameters.getRawParameterValue("SAT_DRIVE")->load() / 100.0f;
-    smoothedDrive.setCurrentAndTargetValue(1.0f + initDrive * 9.0f);
+    hot.smoothedDrive.reset(sampleRate, 0.05);
+    hot.smoothedDrive.setCurrentAndTargetValue(1.0f + params.automatable[driveParam] / 100.0f * 9.0f);
 
     // Sat enable crossfade  (20 ms ramp — eliminates click on toggle)
-    smoothedSatMix.reset(sampleRate, 0.02);
-    bool initEnabled = parameters.getRawParameterValue("SAT_ENABLED")->load() >= 0.5f;
-    int  initMode    = static_cast<int>(parameters.getRawParameterValue("SAT_MODE")->load());
-    smoothedSatMix.setCurrentAndTargetValue((initEnabled && initMode > 0) ? 1.0f : 0.0f);
+    hot.smoothedSatMix.reset(sampleRate, 0.02);
+    hot.smoothedSatMix.setCurrentAndTargetValue((params.satEnabled && params.satMode > 0) ? 1.0f : 0.0f);
+
+    // Peak-envelope followers for auto-gain compensation
+    for (auto& follower : hot.autoGain)
+        follower.prepare(sampleRate);
 
-    // Peak-envelope follower for auto-gain compensation
-    //   5 ms attack  — fast enough to catch transients
-    // 150 ms release — slow enough to avoid pumping
-    satInputEnvelope   = 0.0f;
-    satEnvAttackCoeff  = 1.0f - static_cast<float>(std::exp(-1.0 / (sampleRate * 0.005)));
-    satEnvReleaseCoeff = 1.0f - static_cast<float>(std::exp(-1.0 / (sampleRate * 0.150)));
+    meterAccumulator.prepare(sampleRate);
+    analyserOutput.prepare(sampleRate);
+    analyserInput.prepare(sampleRate);
+
+   #if ENZOGAIN_PROFILING
+    profileTicksPerSample = (double) juce::Time::getHighResolutionTicksPerSecond() / sampleRate;
+
+    if (profileDumper == nullptr)
+    {
+        static std::atomic<int> numInstances { 0 };
+        profileDumper = std::make_unique<EnzoGainDSP::ProfileDumper>(profileFifo, ++numInstances);
+    }
+   #endif
+
+    // Restart the automation timeline; queued events refer to the old one
+    automationEvents.clear();
+    samplePosition.store(0);
+
+    for (int lane = 0; lane < numAutomationLanes; ++lane)
+        hot.automationValues[lane] = hot.lastParameterValues[lane] = params.automatable[lane];
+}
+
+template <typename SampleType>
+void EnzoGainAudioProcessor::SampleLanes<SampleType>::prepare(int numChannels, int numSaturatedChannels,
+                                                              int maxBlockSize)
+{
+    // Per-block scratch lanes
+    scratch.setSize(numScratchLanes, maxBlockSize, false, true, false);
+
+    for (int lane = 0; lane < numScratchLanes; ++lane)
+        lanes[lane] = scratch.getWritePointer(lane);
+
+    // Oversamplers for every factor / filter combination, so switching
+    // never allocates on the audio thread.  Integer latency keeps the
+    // dry path alignable with a plain sample delay.
+    using Oversampler = juce::dsp::Oversampling<SampleType>;
+    int maxLatency = 0;
+
+    for (int filter = 0; filter < 2; ++filter)
+    {
+        auto type = filter == 0 ? Oversampler::filterHalfBandPolyphaseIIR
+                                : Oversampler::filterHalfBandFIREquiripple;
+
+        for (int stage = 0; stage < kMaxOversamplingStages; ++stage)
+        {
+            auto& os = oversamplers[filter][stage];
+            os = std::make_unique<Oversampler>((size_t) numSaturatedChannels, (size_t) (stage + 1), type, true, true);
+            os->initProcessing((size_t) maxBlockSize);
+            maxLatency = juce::jmax(maxLatency, juce::roundToInt(os->getLatencyInSamples()));
+        }
+    }
+
+    wetInput.setSize(numSaturatedChannels, maxBlockSize, false, true, false);
+    dryDelay.prepare(numChannels, maxLatency + 1, maxBlockSize);   // + 1: second-order ADAA
+    activeOversampler = nullptr;
+}
+
+template <typename SampleType>
+void EnzoGainAudioProcessor::SampleLanes<SampleType>::release()
+{
+    std::fill(std::begin(lanes), std::end(lanes), nullptr);
+    activeOversampler = nullptr;
+
+    for (auto& row : oversamplers)
+        for (auto& os : row)
+            os.reset();
+
+    scratch.setSize(0, 0);
+    wetInput.setSize(0, 0);
+    dryDelay.prepare(0, 0, 0);
 }
 
 void EnzoGainAudioProcessor::releaseResources()
 {
 }
 
+bool EnzoGainAudioProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
+{
+    const auto& output = layouts.getMainOutputChannelSet();
+
+    return output == layouts.getMainInputChannelSet()
+        && EnzoGainDSP::ChannelPlan::isSupported(output);
+}
+
 void EnzoGainAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
-    juce::ScopedNoDenormals noDenormals;
     juce::ignoreUnused(midiMessages);
+    process(buffer);
+}
+
+void EnzoGainAudioProcessor::processBlock(juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midiMessages)
+{
+    juce::ignoreUnused(midiMessages);
+    process(buffer);
+}
+
+template <typename SampleType>
+void EnzoGainAudioProcessor::process(juce::AudioBuffer<SampleType>& buffer) noexcept
+{
+    juce::ScopedNoDenormals noDenormals;
+    ENZOGAIN_PROFILE(hot.profileClock.beginBlock());
+
+    // ── Snapshot parameters (atomic reads, real-time safe) ───────────
+    const auto params = readParameters();
 
-    // ── Read parameters (atomic reads, real-time safe) ───────────────
-    float gainLinear  = parameters.getRawParameterValue("GAIN")->load();
-    float lfoStrength = parameters.getRawParameterValue("LFO_STRENGTH")->load() / 100.0f;
-    float lfoFreq     = parameters.getRawParameterValue("LFO_FREQ")->load();
-    bool  lfoEnabled  = parameters.getRawParameterValue("LFO_ENABLED")->load() >= 0.5f;
-    float panValue    = parameters.getRawParameterValue("PAN")->load() / 100.0f;
-    int   satMode     = static_cast<int>(parameters.getRawParameterValue("SAT_MODE")->load());
-    bool  satEnabled  = parameters.getRawParameterValue("SAT_ENABLED")->load() >= 0.5f;
-    float satDrive    = parameters.getRawParameterValue("SAT_DRIVE")->load() / 100.0f;
-    float driveTarget = 1.0f + satDrive * 9.0f;       // 1× … 10×
-
-    // ── Update smoothed targets ──────────────────────────────────────
-    smoothedGain.setTargetValue(gainLinear);
-    smoothedPan.setTargetValue(panValue);
-    smoothedDrive.setTargetValue(driveTarget);
-    smoothedSatMix.setTargetValue((satEnabled && satMode > 0) ? 1.0f : 0.0f);
-
-    // LFO phase increment per sample
-    double phaseIncrement = lfoFreq / currentSampleRate;
-
-    int numChannels = buffer.getNumChannels();
-    int numSamples  = buffer.getNumSamples();
-
-    for (int sample = 0; sample < numSamples; ++sample)
+    hot.smoothedSatMix.setTargetValue((params.satEnabled && params.satMode > 0) ? 1.0f : 0.0f);
+    updateWetPath<SampleType>(params.osFactor, params.osFilter, params.satQuality);
+
+    // ── Automatable parameters: host / UI value, then timestamped events ──
+    //   A value the host or UI changed since the last block wins over any
+    //   earlier event; events then move it at their exact sample.
+    for (int lane = 0; lane < numAutomationLanes; ++lane)
+    {
+        const float value = params.automatable[lane];
+
+        if (value != hot.lastParameterValues[lane])
+            hot.automationValues[lane] = hot.lastParameterValues[lane] = value;
+    }
+
+    const int numSamples = buffer.getNumSamples();
+    const auto blockStart = samplePosition.load(std::memory_order_relaxed);
+    samplePosition.store(blockStart + numSamples, std::memory_order_release);
+
+    // prepareToPlay() must have run, at this processing precision
+    jassert(lanesFor<SampleType>().lanes[0] != nullptr);
+    if (lanesFor<SampleType>().lanes[0] == nullptr)
+        return;
+
+    // ── Analyser input tap (only while an editor asks for it) ────────
+    if (analyserInputTap.load(std::memory_order_relaxed))
+        analyserInput.write(buffer.getArrayOfReadPointers(), buffer.getNumChannels(), numSamples);
+
+    // ── Silence skip, or render segments between change points ───────
+    //   Without events this is a single segment covering the whole block
+    const bool inputSilent = EnzoGainDSP::isSilent(buffer.getArrayOfReadPointers(), buffer.getNumChannels(),
+                                                   numSamples, (SampleType) silenceThreshold);
+
+    if (inputSilent && canSkipSilence(blockStart, numSamples))
     {
-        // ── Per-sample smoothed values ───────────────────────────────
-        float baseGain  = smoothedGain.getNextValue();
-        float driveMult = smoothedDrive.getNextValue();
-        float satMix    = smoothedSatMix.getNextValue();  // 0 = dry, 1 = sat
-
-        // ── LFO modulation ───────────────────────────────────────────
-        float finalGain = baseGain;
-        if (lfoEnabled)
+        skipSilence(buffer, numSamples);
+    }
+    else
+    {
+        hot.skippingSilence = false;
+
+        for (int start = 0; start < numSamples;)
         {
-            float lfoValue = static_cast<float>(
-                std::sin(2.0 * juce::MathConstants<double>::pi * lfoPhase));
-            float lfoMod = 1.0f - lfoStrength
-                         + lfoStrength * (lfoValue * 0.5f + 0.5f);
-            finalGain = baseGain * lfoMod;
+            automationEvents.applyUpTo(blockStart + start, hot.automationValues);
+
+            const int end = (int) juce::jmin((juce::int64) numSamples, automationEvents.nextPosition() - blockStart);
+
+            updateSmootherTargets();
+            processSegment(buffer, start, end - start, params.lfoEnabled,
+                           hot.automationValues[lfoStrengthParam] / 100.0f, params.satMode, params.satQuality);
+            start = end;
         }
-        lfoPhase += phaseIncrement;
-        if (lfoPhase >= 1.0)
-            lfoPhase -= 1.0;
-
-        // ── Equal-power panning ──────────────────────────────────────
-        float pan   = smoothedPan.getNextValue();
-        float angle = (pan + 1.0f) * 0.25f * juce::MathConstants<float>::pi;
-        float leftGain  = std::cos(angle);
-        float rightGain = std::sin(angle);
-
-        // ── Read samples ─────────────────────────────────────────────
-        if (numChannels >= 2)
+    }
+
+    hot.silentSamples = inputSilent ? juce::jmin(hot.silentSamples + numSamples, std::numeric_limits<int>::max() / 2) : 0;
+
+    // ── Metering and analyser output tap (only while an editor is showing) ──
+    if (meteringEnabled.load(std::memory_order_relaxed))
+        meterAccumulator.addBlock(buffer.getArrayOfReadPointers(), buffer.getNumChannels(), numSamples,
+                                  hot.meterSatComp, hot.meterGain, meterFifo);
+
+    if (analyserOutputTap.load(std::memory_order_relaxed))
+        analyserOutput.write(buffer.getArrayOfReadPointers(), buffer.getNumChannels(), numSamples);
+
+    ENZOGAIN_PROFILE(profileFifo.push(hot.profileClock.endBlock(numSamples, isNonRealtime(), profileTicksPerSample)));
+}
+
+void EnzoGainAudioProcessor::updateSmootherTargets() noexcept
+{
+    hot.smoothedGain.setTargetValue(hot.automationValues[gainParam]);
+    hot.smoothedPan.setTargetValue(hot.automationValues[panParam] / 100.0f);
+    hot.smoothedDrive.setTargetValue(1.0f + hot.automationValues[driveParam] / 100.0f * 9.0f);   // 1× … 10×
+    hot.lfo.setFrequency(hot.automationValues[lfoFreqParam]);
+}
+
+bool EnzoGainAudioProcessor::canSkipSilence(juce::int64 blockStart, int numSamples) noexcept
+{
+    if (hot.silentSamples < getSilenceFlushSamples())
+        return false;
+
+    // Timestamped changes inside the block need the segment renderer
+    automationEvents.applyUpTo(blockStart, hot.automationValues);
+
+    if (automationEvents.nextPosition() < blockStart + numSamples)
+        return false;
+
+    updateSmootherTargets();
+
+    if (hot.smoothedGain.isSmoothing() || hot.smoothedPan.isSmoothing()
+        || hot.smoothedDrive.isSmoothing() || hot.smoothedSatMix.isSmoothing())
+        return false;
+
+    // Envelopes only move while the wet path runs; one left over from
+    // before saturation was switched off does not hold the skip back
+    if (hot.smoothedSatMix.getTargetValue() > 0.0f)
+        for (const auto& follower : hot.autoGain)
+            if (! follower.isReleased())
+                return false;
+
+    return true;
+}
+
+template <typename SampleType>
+void EnzoGainAudioProcessor::skipSilence(juce::AudioBuffer<SampleType>& buffer, int numSamples) noexcept
+{
+    // Whatever the dry delay, filters and envelopes still hold is at or
+    // below the threshold by now; clearing it once lets rendering resume
+    // from exact silence
+    if (! hot.skippingSilence)
+    {
+        lanesFor<SampleType>().dryDelay.reset();
+
+        for (auto& follower : hot.autoGain)
+            follower.reset();
+
+        hot.wetPathPrimed = false;   // oversampler / ADAA reset on next use
+        hot.skippingSilence = true;
+    }
+
+    buffer.clear();
+
+    // Analytic phase advance, so the LFO is continuous when audio resumes
+    hot.lfo.advance(numSamples);
+
+    hot.meterGain    = hot.smoothedGain.getTargetValue();
+    hot.meterSatComp = 1.0f;
+}
+
+int EnzoGainAudioProcessor::getSilenceFlushSamples() const noexcept
+{
+    // Latency, then as long again for the oversampling filters to ring out
+    // (FIR half-bands are twice their group delay long), plus a margin
+    // for the IIR ones and the ADAA history
+    return 2 * (int) std::ceil(juce::jmax(0.0f, hot.saturationLatency)) + 64;
+}
+
+double EnzoGainAudioProcessor::getTailLengthSeconds() const
+{
+    // Output rings for the wet path's latency and filter tail; after that
+    // state keeps settling for the auto-gain release while saturating, or
+    // for the longest (50 ms drive) smoother ramp.  A host that stops
+    // calling processBlock after the tail so resumes from released
+    // envelopes, just as after a silence skip.
+    const auto params = readParameters();
+    const bool saturating = params.satEnabled && params.satMode > 0;
+    const double settleSeconds = saturating ? EnzoGainDSP::AutoGainCompensator::getReleaseTimeSeconds() : 0.05;
+
+    return settleSeconds + getSilenceFlushSamples() / currentSampleRate;
+}
+
+bool EnzoGainAudioProcessor::getProfileSummary(EnzoGainDSP::ProfileSummary& dest) const
+{
+   #if ENZOGAIN_PROFILING
+    return profileDumper != nullptr && profileDumper->getSummary(dest);
+   #else
+    juce::ignoreUnused(dest);
+    return false;
+   #endif
+}
+
+juce::File EnzoGainAudioProcessor::getProfileTraceFile() const
+{
+   #if ENZOGAIN_PROFILING
+    if (profileDumper != nullptr)
+        return profileDumper->getTraceFile();
+   #endif
+
+    return {};
+}
+
+bool EnzoGainAudioProcessor::scheduleParameterChange(int lane, juce::int64 position, float value) noexcept
+{
+    if (! juce::isPositiveAndBelow(lane, (int) numAutomationLanes))
+        return false;
+
+    return automationEvents.push(lane, position, value);
+}
+
+int EnzoGainAudioProcessor::findAutomationLane(const juce::String& parameterID) noexcept
+{
+    for (int lane = 0; lane < numAutomationLanes; ++lane)
+        if (parameterID == parameterIDs[lane])
+            return lane;
+
+    return -1;
+}
+
+template <typename SampleType>
+void EnzoGainAudioProcessor::processSegment(juce::AudioBuffer<SampleType>& buffer, int startSample, int numSamples,
+                                            bool lfoEnabled, float lfoStrength, int satMode,
+                                            EnzoGainDSP::SaturationQuality satQuality) noexcept
+{
+    // ── Settled fast path ────────────────────────────────────────────
+    //   Re-checked every segment, so any new target drops straight back to
+    //   the ramped path below.
+    const bool settled = ! hot.smoothedGain.isSmoothing()
+                      && ! hot.smoothedPan.isSmoothing()
+                      && ! hot.smoothedSatMix.isSmoothing()
+                      && hot.smoothedSatMix.getTargetValue() == 0.0f
+                      && (! lfoEnabled || lfoStrength == 0.0f);
+
+    if (settled)
+    {
+        processSettled(buffer, startSample, numSamples);
+        return;
+    }
+
+    // ── Render in scratch-sized chunks ───────────────────────────────
+    //   One kernel per segment: every branch on the configuration is
+    //   resolved here instead of inside the stages
+    const bool smoothing = hot.smoothedGain.isSmoothing()
+                        || hot.smoothedPan.isSmoothing()
+                        || hot.smoothedDrive.isSmoothing()
+                        || hot.smoothedSatMix.isSmoothing();
+
+    const auto kernel = selectChunkKernel<SampleType>(lfoEnabled, satMode, buffer.getNumChannels(), smoothing);
+    const int endSample = startSample + numSamples;
+
+    for (int start = startSample; start < endSample; start += hot.maxBlockSize)
+        (this->*kernel)(buffer, start, juce::jmin(hot.maxBlockSize, endSample - start),
+                        lfoStrength, satQuality);
+}
+
+template <typename SampleType>
+void EnzoGainAudioProcessor::processSettled(juce::AudioBuffer<SampleType>& buffer, int startSample, int numSamples) noexcept
+{
+    using EnzoGainDSP::applyConstantGain;
+    auto& buffers = lanesFor<SampleType>();
+
+    const int numChannels = buffer.getNumChannels();
+    const int endSample   = startSample + numSamples;
+
+    ENZOGAIN_PROFILE(hot.profileClock.begin());
+
+    // Drive only matters while saturating — let it finish its ramp silently
+    hot.smoothedDrive.skip(numSamples);
+
+    // Keep the LFO phase running so enabling it later stays continuous
+    hot.lfo.advance(numSamples);
+
+    hot.wetPathPrimed = false;
+
+    // Reported latency still applies with saturation off
+    for (int start = startSample; start < endSample; start += hot.maxBlockSize)
+        buffers.dryDelay.process(buffer, start, juce::jmin(hot.maxBlockSize, endSample - start));
+
+    const auto gain = (SampleType) hot.smoothedGain.getTargetValue();
+    hot.meterGain    = (float) gain;
+    hot.meterSatComp = 1.0f;
+
+    if (numChannels == 2 || (numChannels > 2 && channelPlan.hasSidedChannels()))
+    {
+        using EnzoGainDSP::PanSide;
+
+        SampleType leftGain, rightGain;
+
+        // Stereo keeps the equal-power law; surround beds balance, unity at centre
+        if (numChannels == 2)
         {
-            float sampleL = buffer.getWritePointer(0)[sample];
-            float sampleR = buffer.getWritePointer(1)[sample];
+            const auto angle = (SampleType) (hot.smoothedPan.getTargetValue() + 1.0f)
+                             * SampleType(0.25) * juce::MathConstants<SampleType>::pi;
+            leftGain  = std::cos(angle);
+            rightGain = std::sin(angle);
+        }
+        else
+        {
+            EnzoGainDSP::balanceGains((SampleType) hot.smoothedPan.getTargetValue(), leftGain, rightGain);
+        }
 
-            // ── Saturation with auto-gain compensation ───────────────
-            if (satMix > 0.0001f)
-            {
-                // 1. Track input peak envelope  (fast attack / slow release)
-                float inputPeak = std::max(std::abs(sampleL), std::abs(sampleR));
-                if (inputPeak > satInputEnvelope)
-                    satInputEnvelope += satEnvAttackCoeff  * (inputPeak - satInputEnvelope);
-                else
-                    satInputEnvelope += satEnvReleaseCoeff * (inputPeak - satInputEnvelope);
-
-                // 2. Auto-gain: what would the waveshaper output at the
-                //    current envelope level?  Compensate to keep peaks steady.
-                float satComp = 1.0f;
-                if (satInputEnvelope > 0.002f)
-                {
-                    // For Fold mode, use bounded peak estimate (avoids
-                    // zero-crossing compensation spikes)
-                    float envDriven;
-                    if (satMode == 4)
-                        envDriven = std::min(satInputEnvelope * driveMult, 1.0f);
-                    else
-                        envDriven = std::abs(
-                            applySaturation(satInputEnvelope * driveMult, satMode));
-                    if (envDriven > 0.0001f)
-                        satComp = juce::jlimit(0.1f, 4.0f,
-                                               satInputEnvelope / envDriven);
-                }
-
-                // 3. Compute wet (saturated + compensated) signal
-                float wetL = applySaturation(sampleL * driveMult, satMode) * satComp;
-                float wetR = applySaturation(sampleR * driveMult, satMode) * satComp;
-
-                // 4. Crossfade dry ↔ wet  (smoothed satMix avoids click)
-                sampleL = sampleL * (1.0f - satMix) + wetL * satMix;
-                sampleR = sampleR * (1.0f - satMix) + wetR * satMix;
-            }
+        // Indexed by PanSide: none, left, right
+        const SampleType sideGains[] = { gain, gain * leftGain, gain * rightGain };
 
-            // ── Gain + panning ───────────────────────────────────────
-            buffer.getWritePointer(0)[sample] = sampleL * finalGain * leftGain;
-            buffer.getWritePointer(1)[sample] = sampleR * finalGain * rightGain;
+        for (int channel = 0; channel < numChannels; ++channel)
+        {
+            const auto side = numChannels == 2 ? (channel == 0 ? PanSide::left : PanSide::right)
+                                               : channelPlan.getSide(channel);
 
-            for (int channel = 2; channel < numChannels; ++channel)
-                buffer.getWritePointer(channel)[sample] *= finalGain;
+            applyConstantGain(buffer.getWritePointer(channel, startSample), sideGains[(size_t) side], numSamples);
         }
+    }
+    else
+    {
+        for (int channel = 0; channel < numChannels; ++channel)
+            applyConstantGain(buffer.getWritePointer(channel, startSample), gain, numSamples);
+    }
+
+    ENZOGAIN_PROFILE(hot.profileClock.lap(EnzoGainDSP::ProfileStage::gainPan));
+}
+
+template <typename SampleType>
+void EnzoGainAudioProcessor::updateWetPath(int factorIndex, int filterIndex,
+                                           EnzoGainDSP::SaturationQuality quality) noexcept
+{
+    using Quality = EnzoGainDSP::SaturationQuality;
+    auto& buffers = lanesFor<SampleType>();
+
+    auto* selected = factorIndex > 0
+        ? buffers.oversamplers[juce::jlimit(0, 1, filterIndex)][juce::jlimit(1, kMaxOversamplingStages, factorIndex) - 1].get()
+        : nullptr;
+
+    if (selected != buffers.activeOversampler)
+    {
+        buffers.activeOversampler = selected;
+        hot.wetPathPrimed = false;
+    }
+
+    hot.activeQuality = quality;
+
+    // ADAA delays by ½ (first order) or 1 (second order) sample at the rate it
+    // runs at; the host only takes whole samples, so the fraction is dropped
+    const float osLatency = selected != nullptr ? (float) selected->getLatencyInSamples() : 0.0f;
+    const float osFactor  = selected != nullptr ? (float) selected->getOversamplingFactor() : 1.0f;
+    const float adaaDelay = quality == Quality::adaaFirstOrder  ? 0.5f
+                          : quality == Quality::adaaSecondOrder ? 1.0f
+                                                                : 0.0f;
+    const float latency = osLatency + adaaDelay / osFactor;
+
+    if (latency == hot.saturationLatency)
+        return;
+
+    hot.saturationLatency = latency;
+
+    const int wholeSamples = (int) std::floor(latency);
+    buffers.dryDelay.setDelay(wholeSamples);
+    pendingLatencySamples.store(wholeSamples, std::memory_order_relaxed);
+}
+
+void EnzoGainAudioProcessor::timerCallback()
+{
+    // Wet path changes made while playing reach the host a tick late; the
+    // dry delay already matches them, so the audio stays aligned
+    const int latency = pendingLatencySamples.load(std::memory_order_relaxed);
+
+    if (latency != getLatencySamples())
+        setLatencySamples(latency);
+}
+
+template <int SatMode, typename SampleType>
+void EnzoGainAudioProcessor::shapeWet(SampleType* data, int numSamples, int channel,
+                                      EnzoGainDSP::SaturationQuality satQuality) noexcept
+{
+    using Quality = EnzoGainDSP::SaturationQuality;
+
+    if (satQuality == Quality::adaaFirstOrder)
+        adaa[channel].processFirstOrder(data, numSamples, SatMode);
+    else if (satQuality == Quality::adaaSecondOrder)
+        adaa[channel].processSecondOrder(data, numSamples, SatMode);
+    else
+        EnzoGainDSP::Waveshaper::process<SatMode>(data, numSamples, satQuality);
+}
+
+// ── Kernel table ─────────────────────────────────────────────────────────
+//   index = lfoOn + 2 · (satMode + 5 · (layout + 3 · smoothing)), one table
+//   per sample type
+namespace
+{
+    constexpr size_t numSatModes   = 5;
+    constexpr size_t numLayouts    = 3;
+    constexpr size_t numChunkKernels = 2 * numSatModes * numLayouts * 2;
+}
+
+template <typename SampleType, size_t... Index>
+constexpr std::array<EnzoGainAudioProcessor::ChunkKernel<SampleType>, sizeof...(Index)>
+EnzoGainAudioProcessor::makeChunkKernelTable(std::index_sequence<Index...>) noexcept
+{
+    return {{ &EnzoGainAudioProcessor::processChunk<SampleType,
+                                                    (Index % 2) != 0,
+                                                    (int) ((Index / 2) % numSatModes),
+                                                    (ChannelLayout) ((Index / (2 * numSatModes)) % numLayouts),
+                                                    (Index / (2 * numSatModes * numLayouts)) != 0>... }};
+}
+
+template <typename SampleType>
+EnzoGainAudioProcessor::ChunkKernel<SampleType> EnzoGainAudioProcessor::selectChunkKernel(bool lfoOn, int satMode,
+                                                                                          int numChannels,
+                                                                                          bool smoothing) noexcept
+{
+    static constexpr auto kernels = makeChunkKernelTable<SampleType>(std::make_index_sequence<numChunkKernels>());
+
+    const auto layout = numChannels <= 1 ? ChannelLayout::mono
+                      : numChannels == 2 ? ChannelLayout::stereo
+                                         : ChannelLayout::multichannel;
+
+    const size_t index = (size_t) lfoOn
+                       + 2 * ((size_t) juce::jlimit(0, (int) numSatModes - 1, satMode)
+                              + numSatModes * ((size_t) layout + numLayouts * (size_t) smoothing));
+
+    return kernels[index];
+}
+
+template <typename SampleType, bool LfoOn, int SatMode, EnzoGainAudioProcessor::ChannelLayout Layout, bool Smoothing>
+void EnzoGainAudioProcessor::processChunk(juce::AudioBuffer<SampleType>& buffer, int startSample, int numSamples,
+                                          float lfoStrength, EnzoGainDSP::SaturationQuality satQuality) noexcept
+{
+    using namespace EnzoGainDSP;
+    using FVO = juce::FloatVectorOperations;
+    using T = SampleType;
+
+    auto& buffers = lanesFor<SampleType>();
+    auto& wetInput = buffers.wetInput;
+    auto* const oversampler = buffers.activeOversampler;
+
+    const int numChannels = buffer.getNumChannels();
+
+    T* gain   = buffers.lanes[gainLane];
+    T* lfoMod = buffers.lanes[lfoLane];
+    T* drive  = buffers.lanes[driveLane];
+    T* mix    = buffers.lanes[mixLane];
+    T* pan    = buffers.lanes[panLane];
+    T* left   = buffers.lanes[leftLane];
+    T* right  = buffers.lanes[rightLane];
+    T* comp   = buffers.lanes[compLane];
+    T* wet    = buffers.lanes[wetLane];
+
+    ENZOGAIN_PROFILE(hot.profileClock.begin());
+
+    // ── Stage 1: smoothing ramps ─────────────────────────────────────
+    bool panIsRamping = false;
+
+    if constexpr (Smoothing)
+    {
+        panIsRamping = hot.smoothedPan.isSmoothing();
+
+        renderRamp(hot.smoothedGain,   gain,  numSamples);
+        renderRamp(hot.smoothedDrive,  drive, numSamples);
+        renderRamp(hot.smoothedSatMix, mix,   numSamples);
+        renderRamp(hot.smoothedPan,    pan,   numSamples);
+    }
+    else
+    {
+        FVO::fill(gain,  (T) hot.smoothedGain.getTargetValue(),   numSamples);
+        FVO::fill(drive, (T) hot.smoothedDrive.getTargetValue(),  numSamples);
+        FVO::fill(mix,   (T) hot.smoothedSatMix.getTargetValue(), numSamples);
+        FVO::fill(pan,   (T) hot.smoothedPan.getTargetValue(),    numSamples);
+    }
+
+    ENZOGAIN_PROFILE(hot.profileClock.lap(ProfileStage::smoothing));
+
+    // ── Stage 2: LFO modulation (folded into the gain lane) ──────────
+    //   gain · (1 - s + s · (v · ½ + ½))  =  gain · ((1 - s/2) + (s/2) · v)
+    if constexpr (LfoOn)
+    {
+        hot.lfo.render(lfoMod, numSamples);
+        FVO::multiply(lfoMod, (T) (0.5f * lfoStrength), numSamples);
+        FVO::add(lfoMod, (T) (1.0f - 0.5f * lfoStrength), numSamples);
+        FVO::multiply(gain, lfoMod, numSamples);
+    }
+    else
+    {
+        // Keep the phase running so re-enabling stays continuous
+        hot.lfo.advance(numSamples);
+    }
+
+    hot.meterGain = (float) gain[numSamples - 1];
+    ENZOGAIN_PROFILE(hot.profileClock.lap(ProfileStage::lfo));
+
+    // ── Stage 3: pan law × gain ──────────────────────────────────────
+    //   Equal-power for stereo; surround beds balance (unity at centre)
+    constexpr bool isMultichannel = Layout == ChannelLayout::multichannel;
+    const bool panned = Layout == ChannelLayout::stereo || (isMultichannel && channelPlan.hasSidedChannels());
+
+    if (panned)
+    {
+        if constexpr (isMultichannel)
+            renderBalanceGains(pan, left, right, numSamples, panIsRamping);
         else
+            renderPanGains(pan, left, right, numSamples, panIsRamping);
+
+        FVO::multiply(left,  gain, numSamples);
+        FVO::multiply(right, gain, numSamples);
+    }
+
+    ENZOGAIN_PROFILE(hot.profileClock.lap(ProfileStage::gainPan));
+
+    // ── Stage 4: saturation with auto-gain compensation ──────────────
+    //   Mono and stereo buffers saturate every channel through one linked
+    //   envelope.  Wider buffers follow channelPlan: one peak detector and
+    //   auto-gain per envelope group, gain only for channels past the plan.
+    //   Whenever the wet path has latency (oversampling, second-order ADAA)
+    //   every channel runs through the dry delay, so the reported latency
+    //   holds whether or not saturation is currently active.
+    const int numSatChannels = isMultichannel ? juce::jmin(numChannels, channelPlan.getNumChannels())
+                                              : juce::jmin(numChannels, 2);
+    const bool satActive = numSatChannels > 0 && juce::jmax(mix[0], mix[numSamples - 1]) > T(0.0001);
+
+    // Capture the undelayed, drive-scaled input before the dry delay: the
+    // wet path brings its own (oversampling / ADAA) delay to match it
+    if (satActive)
+        for (int channel = 0; channel < numSatChannels; ++channel)
+            FVO::multiply(wetInput.getWritePointer(channel),
+                          buffer.getReadPointer(channel, startSample), drive, numSamples);
+
+    buffers.dryDelay.process(buffer, startSample, numSamples);
+
+    if (satActive)
+    {
+        // 1. Waveshaper, in place on the wet input — oversampled when selected
+        if (! hot.wetPathPrimed)
         {
-            for (int channel = 0; channel < numChannels; ++channel)
+            if (oversampler != nullptr)
+                oversampler->reset();
+
+            for (auto& shaper : adaa)
+                shaper.reset();
+
+            hot.wetPathPrimed = true;
+        }
+
+        if (oversampler != nullptr)
+        {
+            auto block = juce::dsp::AudioBlock<T>(wetInput)
+                             .getSubsetChannelBlock(0, (size_t) numSatChannels)
+                             .getSubBlock(0, (size_t) numSamples);
+
+            auto upBlock = oversampler->processSamplesUp(block);
+
+            for (int channel = 0; channel < numSatChannels; ++channel)
+                shapeWet<SatMode>(upBlock.getChannelPointer((size_t) channel),
+                                  (int) upBlock.getNumSamples(), channel, satQuality);
+
+            oversampler->processSamplesDown(block);
+        }
+        else
+        {
+            for (int channel = 0; channel < numSatChannels; ++channel)
+                shapeWet<SatMode>(wetInput.getWritePointer(channel), numSamples, channel, satQuality);
+        }
+
+        ENZOGAIN_PROFILE(hot.profileClock.lap(ProfileStage::saturation));
+
+        // 2. Per envelope group
+        const int numGroups = isMultichannel ? ChannelPlan::maxEnvelopeGroups : 1;
+
+        for (int group = 0; group < numGroups; ++group)
+        {
+            int members[ChannelPlan::maxChannels];
+            const T* memberData[ChannelPlan::maxChannels];
+            int numMembers = 0;
+
+            for (int channel = 0; channel < numSatChannels; ++channel)
+            {
+                if (isMultichannel && channelPlan.getEnvelopeGroup(channel) != group)
+                    continue;
+
+                members[numMembers] = channel;
+                memberData[numMembers++] = buffer.getReadPointer(channel, startSample);
+            }
+
+            if (numMembers == 0)
+                continue;
+
+            // Linked peak detector
+            peakDetect(comp, memberData, numMembers, wet, numSamples);
+
+            // Auto-gain: envelope follower per sample, compensation gain at
+            // control rate from the shared tables  (keeps peaks steady)
+            hot.autoGain[group].process(comp, drive, numSamples, SatMode, *compensationTables);
+
+            if (group == 0)
+                hot.meterSatComp = (float) comp[numSamples - 1];
+
+            // Wet · comp, then crossfade dry ↔ wet  (smoothed satMix avoids click)
+            for (int member = 0; member < numMembers; ++member)
             {
-                float s = buffer.getWritePointer(channel)[sample];
-
-                if (satMix > 0.0001f)
-                {
-                    float inputPeak = std::abs(s);
-                    if (inputPeak > satInputEnvelope)
-                        satInputEnvelope += satEnvAttackCoeff  * (inputPeak - satInputEnvelope);
-                    else
-                        satInputEnvelope += satEnvReleaseCoeff * (inputPeak - satInputEnvelope);
-
-                    float satComp = 1.0f;
-                    if (satInputEnvelope > 0.002f)
-                    {
-                        float envDriven;
-                        if (satMode == 4)
-                            envDriven = std::min(satInputEnvelope * driveMult, 1.0f);
-                        else
-                            envDriven = std::abs(
-                                applySaturation(satInputEnvelope * driveMult, satMode));
-                        if (envDriven > 0.0001f)
-                            satComp = juce::jlimit(0.1f, 4.0f,
-                                                   satInputEnvelope / envDriven);
-                    }
-
-                    float wet = applySaturation(s * driveMult, satMode) * satComp;
-                    s = s * (1.0f - satMix) + wet * satMix;
-                }
-
-                buffer.getWritePointer(channel)[sample] = s * finalGain;
+                FVO::multiply(wet, wetInput.getReadPointer(members[member]), comp, numSamples);
+                crossfade(buffer.getWritePointer(members[member], startSample), wet, mix, numSamples);
             }
         }
+
+        ENZOGAIN_PROFILE(hot.profileClock.lap(ProfileStage::envelope));
     }
+    else
+    {
+        hot.wetPathPrimed = false;   // filter / ADAA state is stale once we stop feeding it
+        hot.meterSatComp = 1.0f;
+
+        ENZOGAIN_PROFILE(hot.profileClock.lap(ProfileStage::saturation));   // the dry delay
+    }
+
+    // ── Stage 5: gain + panning ──────────────────────────────────────
+    if constexpr (Layout == ChannelLayout::stereo)
+    {
+        FVO::multiply(buffer.getWritePointer(0, startSample), left,  numSamples);
+        FVO::multiply(buffer.getWritePointer(1, startSample), right, numSamples);
+    }
+    else if constexpr (isMultichannel)
+    {
+        const T* const sideGains[] = { gain, left, right };   // indexed by PanSide
+
+        for (int channel = 0; channel < numChannels; ++channel)
+            FVO::multiply(buffer.getWritePointer(channel, startSample),
+                          sideGains[(size_t) channelPlan.getSide(channel)], numSamples);
+    }
+    else
+    {
+        for (int channel = 0; channel < numChannels; ++channel)
+            FVO::multiply(buffer.getWritePointer(channel, startSample), gain, numSamples);
+    }
+
+    ENZOGAIN_PROFILE(hot.profileClock.lap(ProfileStage::gainPan));
 }
 
 juce::AudioProcessorEditor* EnzoGainAudioProcessor::createEditor()
 {
-    return new EnzoGainAudioProcessorEditor(*this);
+   #if ENZOGAIN_HEADLESS
+    return nullptr;
+   #else
+    return new EnzoGainEditorHost(*this);
+   #endif
+}
+
+EnzoGainAudioProcessor::EditorMode EnzoGainAudioProcessor::getEditorMode() const
+{
+    return parameters.state.getProperty(editorModeProperty).toString() == "native" ? EditorMode::native
+                                                                                    : EditorMode::web;
+}
+
+void EnzoGainAudioProcessor::setEditorMode(EditorMode mode)
+{
+    parameters.state.setProperty(editorModeProperty, mode == EditorMode::native ? "native" : "web", nullptr);
 }
 
 void EnzoGainAudioProcessor::getStateInformation(juce::MemoryBlock& destData)
+{
+    EnzoGainState::Entry entries[numParameters];
+
+    for (int index = 0; index < numParameters; ++index)
+        entries[index] = { parameterHashes[index], parameterValues[index]->load() };
+
+    const juce::uint32 flags = getEditorMode() == EditorMode::native ? EnzoGainState::nativeEditor : 0u;
+    EnzoGainState::write(destData, entries, numParameters, flags);
+}
+
+void EnzoGainAudioProcessor::getXmlStateInformation(juce::MemoryBlock& destData)
 {
     auto state = parameters.copyState();
     std::unique_ptr<juce::XmlElement> xml(state.createXml());
@@ -284,12 +961,57 @@ void EnzoGainAudioProcessor::getStateInformation(juce::MemoryBlock& destData)
 
 void EnzoGainAudioProcessor::setStateInformation(const void* data, int sizeInBytes)
 {
+    if (EnzoGainState::isBinaryState(data, sizeInBytes))
+    {
+        setBinaryState(data, sizeInBytes);
+        return;
+    }
+
+    // Sessions saved before the binary format
     std::unique_ptr<juce::XmlElement> xmlState(getXmlFromBinary(data, sizeInBytes));
 
     if (xmlState != nullptr && xmlState->hasTagName(parameters.state.getType()))
         parameters.replaceState(juce::ValueTree::fromXml(*xmlState));
 }
 
+void EnzoGainAudioProcessor::setBinaryState(const void* data, int sizeInBytes)
+{
+    float values[numParameters];
+    bool found[numParameters] {};
+    juce::uint32 flags = 0;
+
+    const bool valid = EnzoGainState::read(data, sizeInBytes, flags, [&](juce::uint32 idHash, float value)
+    {
+        for (int index = 0; index < numParameters; ++index)
+        {
+            if (parameterHashes[index] == idHash)
+            {
+                values[index] = value;
+                found[index] = true;
+                return;
+            }
+        }
+        // A parameter this version doesn't have
+    });
+
+    // Truncated, or from a newer schema: keep the current state, as for unreadable XML
+    if (! valid)
+        return;
+
+    for (int index = 0; index < numParameters; ++index)
+    {
+        // Missing values fall back to the default, as replaceState() does
+        auto& parameter = *parameterObjects[index];
+        const float normalised = found[index] ? parameter.convertTo0to1(values[index])
+                                              : parameter.getDefaultValue();
+
+        if (parameter.getValue() != normalised)
+            parameter.setValueNotifyingHost(normalised);
+    }
+
+    setEditorMode((flags & EnzoGainState::nativeEditor) != 0 ? EditorMode::native : EditorMode::web);
+}
+
 // Factory function
 juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter()
 {
@@ -1,8 +1,39 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include "dsp/BlockKernels.h"
+#include "dsp/Waveshapers.h"
+#include "dsp/BlockDelay.h"
+#include "dsp/Adaa.h"
+#include "dsp/Lfo.h"
+#include "dsp/AutoGain.h"
+#include "dsp/ParameterEvents.h"
+#include "dsp/ChannelLayouts.h"
+#include "dsp/Metering.h"
+#include "dsp/SnapshotRing.h"
+#include "dsp/Profiling.h"
+#include "state/BinaryState.h"
 
-class EnzoGainAudioProcessor : public juce::AudioProcessor
+// Set to 1 to build the processor without its WebView editor
+// (headless benchmark and command-line tools)
+#ifndef ENZOGAIN_HEADLESS
+ #define ENZOGAIN_HEADLESS 0
+#endif
+
+// Set to 1 to compile in the per-stage processBlock instrumentation
+// (dsp/Profiling.h).  At 0 every probe expands to nothing.
+#ifndef ENZOGAIN_PROFILING
+ #define ENZOGAIN_PROFILING 0
+#endif
+
+#if ENZOGAIN_PROFILING
+ #define ENZOGAIN_PROFILE(statement) statement
+#else
+ #define ENZOGAIN_PROFILE(statement)
+#endif
+
+class EnzoGainAudioProcessor : public juce::AudioProcessor,
+                               private juce::Timer
 {
 public:
     EnzoGainAudioProcessor();
@@ -10,16 +41,25 @@ public:
 
     void prepareToPlay(double sampleRate, int samplesPerBlock) override;
     void releaseResources() override;
+
+    // Matching main in / out: mono, stereo, LCR, 5.1, 7.1, 7.1.4, or
+    // first- to third-order ambisonics (see dsp/ChannelLayouts.h)
+    bool isBusesLayoutSupported(const BusesLayout& layouts) const override;
     void processBlock(juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlock(juce::AudioBuffer<double>&, juce::MidiBuffer&) override;
+
+    // Both precisions run the same templated pipeline; only the lanes for the
+    // precision chosen before prepareToPlay are allocated
+    bool supportsDoublePrecisionProcessing() const override { return true; }
 
     juce::AudioProcessorEditor* createEditor() override;
-    bool hasEditor() const override { return true; }
+    bool hasEditor() const override { return ! ENZOGAIN_HEADLESS; }
 
     const juce::String getName() const override { return "EnzoGain"; }
     bool acceptsMidi() const override { return false; }
     bool producesMidi() const override { return false; }
     bool isMidiEffect() const override { return false; }
-    double getTailLengthSeconds() const override { return 0.0; }
+    double getTailLengthSeconds() const override;
 
     int getNumPrograms() override { return 1; }
     int getCurrentProgram() override { return 0; }
@@ -30,60 +70,338 @@ public:
     void getStateInformation(juce::MemoryBlock& destData) override;
     void setStateInformation(const void* data, int sizeInBytes) override;
 
+    // State is saved in the compact binary layout of state/BinaryState.h;
+    // setStateInformation() still reads the XML state of earlier versions.
+    // This writes that XML form, for tools and comparisons.
+    void getXmlStateInformation(juce::MemoryBlock& destData);
+
     // Public access to parameters for editor
     juce::AudioProcessorValueTreeState parameters;
 
+    // ── Editor mode ──────────────────────────────────────────────────
+    //   The WebView editor, or the lightweight native one for sessions
+    //   with many editors open.  Kept as a property of the parameter
+    //   state, so it is saved with the session; an open editor switches
+    //   as soon as it changes.  Message thread only.
+    enum class EditorMode
+    {
+        web = 0,
+        native
+    };
+
+    static const juce::Identifier editorModeProperty;
+
+    EditorMode getEditorMode() const;
+    void setEditorMode(EditorMode mode);
+
+    // Exact group delay of the saturation wet path in samples, including the
+    // fractional part (ADAA) that setLatencySamples cannot express.  The
+    // whole-sample latency is reported in prepareToPlay, and for changes
+    // made while playing from a message-thread timer (see timerCallback)
+    float getSaturationLatencySamples() const noexcept { return hot.saturationLatency; }
+
+    // ── Sample-accurate automation ───────────────────────────────────
+    //   GAIN, PAN, SAT_DRIVE, LFO_STRENGTH and LFO_FREQ (the ParameterIndex
+    //   lanes below numAutomationLanes) accept timestamped changes (plain
+    //   parameter units) at an absolute position on the processor's sample
+    //   timeline; processBlock splits at each one.  One producer thread per
+    //   lane; returns false if the lane is not automatable this way or its
+    //   queue is full.
+    //
+    //   EnzoGainBatch feeds it from --automate.  In a DAW the JUCE wrappers
+    //   hand the processor one value per parameter per block, which
+    //   process() reads at the block start, so host automation there stays
+    //   block-accurate.
+    bool scheduleParameterChange(int lane, juce::int64 samplePosition, float value) noexcept;
+
+    // The lane of an automatable parameter ID, or -1
+    static int findAutomationLane(const juce::String& parameterID) noexcept;
+
+    // Position of the next processBlock's first sample (0 after prepareToPlay)
+    juce::int64 getSamplePosition() const noexcept { return samplePosition.load(std::memory_order_acquire); }
+
+    // ── Metering ─────────────────────────────────────────────────────
+    //   Off until an editor asks for it.  While on, processBlock publishes
+    //   about 60 level frames a second whatever the buffer size; the
+    //   editor pops them on the message thread.
+    void setMeteringEnabled(bool shouldMeter) noexcept { meteringEnabled.store(shouldMeter, std::memory_order_relaxed); }
+    int popMeterFrames(EnzoGainDSP::MeterFrame* dest, int maxFrames) noexcept { return meterFifo.pop(dest, maxFrames); }
+
+    // ── Analyser taps ────────────────────────────────────────────────
+    //   Off until an editor shows its analyser.  While on, processBlock
+    //   writes a mono mix of its output (and, with the input tap, of the
+    //   unprocessed input, i.e. pre-saturation) into snapshot rings that
+    //   the editor's analyser thread reads at its own pace.
+    void setAnalyserTaps(bool outputTap, bool inputTap) noexcept
+    {
+        analyserOutputTap.store(outputTap, std::memory_order_relaxed);
+        analyserInputTap.store(inputTap, std::memory_order_relaxed);
+    }
+
+    const EnzoGainDSP::SnapshotRing& getAnalyserOutputRing() const noexcept { return analyserOutput; }
+    const EnzoGainDSP::SnapshotRing& getAnalyserInputRing() const noexcept  { return analyserInput; }
+
+    // ── Profiling ────────────────────────────────────────────────────
+    //   ENZOGAIN_PROFILING builds only: rolling per-stage statistics and
+    //   the Chrome trace file being written.  False / empty otherwise.
+    bool getProfileSummary(EnzoGainDSP::ProfileSummary& dest) const;
+    juce::File getProfileTraceFile() const;
+
+    // ── Parameter snapshot ───────────────────────────────────────────
+    //   Everything processBlock reads from the parameters, taken once per
+    //   block through atomics resolved in the constructor.  One cache line.
+    enum ParameterIndex
+    {
+        gainParam = 0,          // sample-accurate lanes first (see scheduleParameterChange)
+        panParam,
+        driveParam,
+        lfoStrengthParam,
+        lfoFreqParam,
+        numAutomationLanes,
+        lfoEnabledParam = numAutomationLanes,
+        satModeParam,
+        satEnabledParam,
+        satQualityParam,
+        osFactorParam,
+        osFilterParam,
+        numParameters
+    };
+
+    struct alignas(64) ParameterSnapshot
+    {
+        float automatable[numAutomationLanes];   // plain values, ParameterIndex order
+        int   satMode;
+        int   osFactor;
+        int   osFilter;
+        EnzoGainDSP::SaturationQuality satQuality;
+        bool  lfoEnabled;
+        bool  satEnabled;
+    };
+
+    ParameterSnapshot readParameters() const noexcept;
+
 private:
     static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
 
-    // Saturation processing
-    static inline float applySaturation(float x, int mode) noexcept
+    // Channel layouts the chunk kernels are specialised for
+    enum class ChannelLayout
     {
-        switch (mode)
-        {
-            case 1: // Tape — soft symmetric tanh saturation
-                return std::tanh(x);
-
-            case 2: // Tube — asymmetric exponential (adds even harmonics)
-            {
-                if (x >= 0.0f)
-                    return 1.0f - std::exp(-x);
-                else
-                    return -(1.0f - std::exp(x * 0.8f)) / 0.8f;
-            }
-
-            case 3: // Digital — hard clip at ±1
-                return juce::jlimit(-1.0f, 1.0f, x);
-
-            case 4: // Fold — triangle wavefolder (bounded to ±1)
-            {
-                // Classic triangle fold: always stays in [-1, 1]
-                float phase = std::fmod(x + 1.0f, 4.0f);
-                if (phase < 0.0f) phase += 4.0f;
-                return (phase < 2.0f) ? (phase - 1.0f) : (3.0f - phase);
-            }
-
-            default:
-                return x;
-        }
+        mono = 0,       // one channel (or none): no pan law
+        stereo,         // exactly two channels
+        multichannel,   // more than two: pan law and envelope groups from channelPlan
+        numLayouts
+    };
+
+    // Shared body of both processBlock overloads
+    template <typename SampleType>
+    void process(juce::AudioBuffer<SampleType>& buffer) noexcept;
+
+    // Renders one chunk (≤ maxBlockSize samples) through the staged pipeline.
+    // Every per-block decision is a template argument, so each of the
+    // 2 × 5 × 3 × 2 instantiations per sample type compiles to straight-line
+    // stage calls.
+    template <typename SampleType, bool LfoOn, int SatMode, ChannelLayout Layout, bool Smoothing>
+    void processChunk(juce::AudioBuffer<SampleType>& buffer, int startSample, int numSamples,
+                      float lfoStrength, EnzoGainDSP::SaturationQuality satQuality) noexcept;
+
+    template <typename SampleType>
+    using ChunkKernel = void (EnzoGainAudioProcessor::*)(juce::AudioBuffer<SampleType>&, int, int, float,
+                                                         EnzoGainDSP::SaturationQuality) noexcept;
+
+    // Picks the processChunk instantiation for this block's configuration
+    template <typename SampleType>
+    static ChunkKernel<SampleType> selectChunkKernel(bool lfoOn, int satMode, int numChannels, bool smoothing) noexcept;
+
+    template <typename SampleType, size_t... Index>
+    static constexpr std::array<ChunkKernel<SampleType>, sizeof...(Index)> makeChunkKernelTable(std::index_sequence<Index...>) noexcept;
+
+    // Renders [startSample, startSample + numSamples) with the current
+    // smoother targets: the settled fast path, or the selected kernel in chunks
+    template <typename SampleType>
+    void processSegment(juce::AudioBuffer<SampleType>& buffer, int startSample, int numSamples,
+                        bool lfoEnabled, float lfoStrength, int satMode,
+                        EnzoGainDSP::SaturationQuality satQuality) noexcept;
+
+    // ── Silence skip ─────────────────────────────────────────────────
+    //   Input within ±silenceThreshold (-120 dBFS) for longer than the wet
+    //   path's latency and ring-out, no smoother moving and every envelope
+    //   released: the output is silence, so the block is cleared instead
+    //   of rendered and only the LFO phase moves on.
+    static constexpr float silenceThreshold = 1.0e-6f;
+
+    // Sets the smoother and LFO targets from the current automation values
+    void updateSmootherTargets() noexcept;
+
+    // True if the block starting at blockStart can be skipped (input already
+    // known silent); applies the block's automation values as a side effect
+    bool canSkipSilence(juce::int64 blockStart, int numSamples) noexcept;
+
+    template <typename SampleType>
+    void skipSilence(juce::AudioBuffer<SampleType>& buffer, int numSamples) noexcept;
+
+    // Samples of silent input after which the wet path has rung out
+    int getSilenceFlushSamples() const noexcept;
+
+    // Fast path for segments where no smoother is moving, saturation is fully
+    // off and the LFO contributes nothing: two constant per-channel gains
+    template <typename SampleType>
+    void processSettled(juce::AudioBuffer<SampleType>& buffer, int startSample, int numSamples) noexcept;
+
+    // Selects the oversampler for the current OS_FACTOR / OS_FILTER and
+    // keeps the dry delay in step with it and with the ADAA group delay of
+    // the current SAT_QUALITY.  The host-facing latency is only published
+    // to pendingLatencySamples: setLatencySamples notifies the host under
+    // the processor's listener lock, which the audio thread must not take
+    template <typename SampleType>
+    void updateWetPath(int factorIndex, int filterIndex,
+                       EnzoGainDSP::SaturationQuality quality) noexcept;
+
+    // Shapes one channel of the wet path in place, at whatever rate it runs
+    template <int SatMode, typename SampleType>
+    void shapeWet(SampleType* data, int numSamples, int channel,
+                  EnzoGainDSP::SaturationQuality satQuality) noexcept;
+
+    // Per-block scratch buffers (one row per pipeline lane, sized in prepareToPlay)
+    enum ScratchLane
+    {
+        gainLane = 0,   // smoothed gain × LFO modulation
+        lfoLane,        // LFO output → gain modulation factor
+        driveLane,      // smoothed drive multiplier
+        mixLane,        // smoothed saturation crossfade
+        panLane,        // smoothed pan (-1 … +1)
+        leftLane,       // left  output gain (pan law × gain)
+        rightLane,      // right output gain (pan law × gain)
+        compLane,       // peak detector → auto-gain compensation
+        wetLane,        // wet (saturated) signal for the channel being processed
+        numScratchLanes
+    };
+
+    // ── Per-precision buffers ────────────────────────────────────────
+    //   Scratch lanes, oversamplers, wet input and dry delay in the sample
+    //   type of the processBlock overload in use.  prepareToPlay fills the
+    //   set for the current processing precision and releases the other.
+    static constexpr int kMaxOversamplingStages = 3;
+
+    template <typename SampleType>
+    struct SampleLanes
+    {
+        SampleType* lanes[numScratchLanes] {};   // scratch rows, cached in prepare; null when released
+        juce::dsp::Oversampling<SampleType>* activeOversampler = nullptr;
+
+        juce::AudioBuffer<SampleType> scratch;
+
+        // Saturation oversampling  (2× / 4× / 8× half-band polyphase, IIR or FIR)
+        std::unique_ptr<juce::dsp::Oversampling<SampleType>> oversamplers[2][kMaxOversamplingStages];
+        juce::AudioBuffer<SampleType> wetInput;           // drive-scaled input, shaped in place
+        EnzoGainDSP::BlockDelay<SampleType> dryDelay;     // aligns dry / unsaturated channels
+
+        void prepare(int numChannels, int numSaturatedChannels, int maxBlockSize);
+        void release();
+    };
+
+    template <typename SampleType>
+    SampleLanes<SampleType>& lanesFor() noexcept
+    {
+        if constexpr (std::is_same_v<SampleType, double>)
+            return doubleLanes;
+        else
+            return floatLanes;
     }
 
-    // Smoothed gain to avoid zipper noise
-    juce::SmoothedValue<float> smoothedGain;
-    juce::SmoothedValue<float> smoothedPan;
+    // ── Hot per-instance state ───────────────────────────────────────
+    //   Everything the audio thread touches on every block, packed into one
+    //   contiguous, cache-line-aligned block so a call costs a handful of
+    //   line fills even at 16-sample buffers.
+    struct alignas(64) HotState
+    {
+        int maxBlockSize = 0;
+
+        // Smoothed gain to avoid zipper noise
+        juce::SmoothedValue<float> smoothedGain;
+        juce::SmoothedValue<float> smoothedPan;
+
+        // Smoothed saturation parameters  (avoids clicks / zipper noise)
+        juce::SmoothedValue<float> smoothedDrive;   // drive multiplier (1‥10)
+        juce::SmoothedValue<float> smoothedSatMix;  // 0 = dry, 1 = wet  (crossfades on enable/disable)
 
-    // Smoothed saturation parameters  (avoids clicks / zipper noise)
-    juce::SmoothedValue<float> smoothedDrive;   // drive multiplier (1‥10)
-    juce::SmoothedValue<float> smoothedSatMix;  // 0 = dry, 1 = wet  (crossfades on enable/disable)
+        // Automatable values in effect at the current sample, and the
+        // host / UI values last seen at block start
+        float automationValues[numAutomationLanes] {};
+        float lastParameterValues[numAutomationLanes] {};
 
-    // Peak-envelope follower for auto-gain compensation
-    float satInputEnvelope  = 0.0f;
-    float satEnvAttackCoeff = 0.0f;
-    float satEnvReleaseCoeff = 0.0f;
+        // Wet path selection
+        EnzoGainDSP::SaturationQuality activeQuality = EnzoGainDSP::SaturationQuality::fast;
+        float saturationLatency = 0.0f;
+        bool wetPathPrimed = false;                 // false → reset filter/ADAA state before next use
+
+        // Peak-envelope follower + control-rate auto-gain compensation,
+        // one per linked envelope group
+        EnzoGainDSP::AutoGainCompensator autoGain[EnzoGainDSP::ChannelPlan::maxEnvelopeGroups];
+
+        // LFO (control-rate, phase-continuous)
+        EnzoGainDSP::Lfo lfo;
+
+        // Gain state at the end of the last rendered chunk, for the meters
+        float meterSatComp = 1.0f;
+        float meterGain    = 1.0f;
+
+        // Consecutive input samples within ±silenceThreshold, and whether
+        // the last block was skipped
+        int  silentSamples = 0;
+        bool skippingSilence = false;
+
+       #if ENZOGAIN_PROFILING
+        EnzoGainDSP::StageClock profileClock;
+       #endif
+    };
+
+    HotState hot;
+
+    // ── Cold / bulk state ────────────────────────────────────────────
+    static const char* const parameterIDs[numParameters];
+    std::atomic<float>* parameterValues[numParameters] {};   // resolved once in the constructor
+    juce::RangedAudioParameter* parameterObjects[numParameters] {};
+    juce::uint32 parameterHashes[numParameters] {};          // EnzoGainState::hashParameterID
+
+    void setBinaryState(const void* data, int sizeInBytes);
+
+    SampleLanes<float>  floatLanes;
+    SampleLanes<double> doubleLanes;
+
+    std::vector<EnzoGainDSP::AdaaShaper> adaa;    // per saturated channel (double state either way)
+
+    // Pan law and envelope linking of the current bus layout
+    EnzoGainDSP::ChannelPlan channelPlan;
+
+    // g(u) = u / |f(u)| auto-gain tables shared by every instance in the process
+    juce::SharedResourcePointer<EnzoGainDSP::CompensationTables> compensationTables;
+
+    // Timestamped change queues for the automatable parameters
+    EnzoGainDSP::ParameterEventQueue<numAutomationLanes> automationEvents;
+    std::atomic<juce::int64> samplePosition { 0 };
+
+    // Level frames for the editor
+    EnzoGainDSP::MeterAccumulator meterAccumulator;
+    EnzoGainDSP::MeterFifo meterFifo;
+    std::atomic<bool> meteringEnabled { false };
+
+    // Audio snapshots for the editor's analyser
+    EnzoGainDSP::SnapshotRing analyserOutput, analyserInput;
+    std::atomic<bool> analyserOutputTap { false }, analyserInputTap { false };
+
+   #if ENZOGAIN_PROFILING
+    // Per-block stage timings; the dumper starts with the first prepareToPlay
+    EnzoGainDSP::ProfileFifo profileFifo;
+    std::unique_ptr<EnzoGainDSP::ProfileDumper> profileDumper;
+    double profileTicksPerSample = 0.0;
+   #endif
 
-    // LFO state
-    double lfoPhase = 0.0;
     double currentSampleRate = 44100.0;
 
+    // Whole-sample latency of the current wet path, as set by updateWetPath;
+    // timerCallback passes changes on to setLatencySamples
+    std::atomic<int> pendingLatencySamples { 0 };
+    void timerCallback() override;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(EnzoGainAudioProcessor)
 };
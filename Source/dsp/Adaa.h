@@ -0,0 +1,225 @@
+#pragma once
+#include "Waveshapers.h"
+
+/**
+ * Antiderivative anti-aliasing (ADAA) for the four saturation curves.
+ *
+ * First order:   y[n] = (F1(x[n]) - F1(x[n-1])) / (x[n] - x[n-1])
+ * Second order:  y[n] = 2 / (x[n] - x[n-2]) · (D[n] - D[n-1]),
+ *                D[n] = (F2(x[n]) - F2(x[n-1])) / (x[n] - x[n-1])
+ *
+ * F1/F2 are the first and second antiderivatives of each curve, all in
+ * closed form and evaluated in double precision (the differences cancel
+ * heavily).  When successive inputs are too close the divided differences
+ * are ill-conditioned, so each order falls back to evaluating the lower
+ * derivative at the midpoint.
+ *
+ * Group delay: ½ sample for first order, 1 sample for second order.
+ */
+namespace EnzoGainDSP
+{
+    namespace Antiderivative
+    {
+        constexpr double ln2 = 0.69314718055994530942;
+
+        /** Dilogarithm Li2(z) for z ∈ [-1, 0].  Uses the Landen identity
+            Li2(z) = -Li2(z / (z - 1)) - ½ ln²(1 - z), which maps the argument
+            into [0, ½] where the power series converges to < 1e-10 in 24 terms. */
+        inline double dilogNegative(double z) noexcept
+        {
+            const double w = z / (z - 1.0);
+            double term = w, sum = 0.0;
+
+            for (int k = 1; k <= 24; ++k)
+            {
+                sum  += term / (double) (k * k);
+                term *= w;
+            }
+
+            const double l = std::log1p(-z);
+            return -sum - 0.5 * l * l;
+        }
+
+        /** Curve itself, in double (used by the near-equal fallbacks). */
+        inline double f0(double x, int mode) noexcept
+        {
+            switch (mode)
+            {
+                case 1: return std::tanh(x);
+                case 2: return x >= 0.0 ? 1.0 - std::exp(-x) : 1.25 * (std::exp(0.8 * x) - 1.0);
+                case 3: return juce::jlimit(-1.0, 1.0, x);
+                case 4:
+                {
+                    const double p = x + 1.0 - 4.0 * std::floor((x + 1.0) * 0.25);
+                    return p < 2.0 ? p - 1.0 : 3.0 - p;
+                }
+                default: return x;
+            }
+        }
+
+        /** First antiderivative. */
+        inline double f1(double x, int mode) noexcept
+        {
+            switch (mode)
+            {
+                case 1: // log cosh(x), overflow-free
+                {
+                    const double a = std::abs(x);
+                    return a + std::log1p(std::exp(-2.0 * a)) - ln2;
+                }
+
+                case 2:
+                    return x >= 0.0 ? x + std::exp(-x) - 1.0
+                                    : 1.5625 * std::exp(0.8 * x) - 1.25 * x - 1.5625;
+
+                case 3:
+                {
+                    const double a = std::abs(x);
+                    return a <= 1.0 ? 0.5 * x * x : a - 0.5;
+                }
+
+                case 4: // periodic: the triangle has zero mean over its period of 4
+                {
+                    const double p = x + 1.0 - 4.0 * std::floor((x + 1.0) * 0.25);
+                    return p < 2.0 ? 0.5 * p * p - p
+                                   : -0.5 * p * p + 3.0 * p - 4.0;
+                }
+
+                default: return 0.5 * x * x;
+            }
+        }
+
+        /** Second antiderivative (F2' = F1, F2(0) = 0 except Fold, whose F2 is periodic). */
+        inline double f2(double x, int mode) noexcept
+        {
+            switch (mode)
+            {
+                case 1: // ∫ log cosh — odd, via the dilogarithm
+                {
+                    const double a = std::abs(x);
+                    const double g = 0.5 * a * a - a * ln2
+                                   + 0.5 * (dilogNegative(-std::exp(-2.0 * a))
+                                            + juce::MathConstants<double>::pi * juce::MathConstants<double>::pi / 12.0);
+                    return x >= 0.0 ? g : -g;
+                }
+
+                case 2:
+                    return x >= 0.0 ? 0.5 * x * x - std::exp(-x) - x + 1.0
+                                    : 1.953125 * std::exp(0.8 * x) - 0.625 * x * x - 1.5625 * x - 1.953125;
+
+                case 3:
+                {
+                    const double a = std::abs(x);
+                    const double g = a <= 1.0 ? a * a * a / 6.0 : 0.5 * a * a - 0.5 * a + 1.0 / 6.0;
+                    return x >= 0.0 ? g : -g;
+                }
+
+                case 4:
+                {
+                    const double p = x + 1.0 - 4.0 * std::floor((x + 1.0) * 0.25);
+                    return p < 2.0 ? p * p * p / 6.0 - 0.5 * p * p
+                                   : -p * p * p / 6.0 + 1.5 * p * p - 4.0 * p + 8.0 / 3.0;
+                }
+
+                default: return x * x * x / 6.0;
+            }
+        }
+    }
+
+    /**
+     * One channel of ADAA waveshaping.  Holds the input history and the
+     * cached antiderivative values so each sample costs one F1 (first order)
+     * or one F2 (second order) evaluation in the common case.
+     */
+    class AdaaShaper
+    {
+    public:
+        void reset() noexcept
+        {
+            x1 = x2 = 0.0;
+            d1 = 0.0;
+            cachedMode = -1;
+        }
+
+        template <typename SampleType>
+        void processFirstOrder(SampleType* data, int numSamples, int mode) noexcept
+        {
+            using namespace Antiderivative;
+            constexpr double tolerance = 1.0e-5;
+
+            if (mode != cachedMode)
+                primeCache(mode);
+
+            for (int i = 0; i < numSamples; ++i)
+            {
+                const double x0 = data[i];
+                const double F0 = f1(x0, mode);
+                const double dx = x0 - x1;
+
+                data[i] = (SampleType) (std::abs(dx) < tolerance ? f0(0.5 * (x0 + x1), mode)
+                                                                 : (F0 - F1x1) / dx);
+                x1   = x0;
+                F1x1 = F0;
+            }
+        }
+
+        template <typename SampleType>
+        void processSecondOrder(SampleType* data, int numSamples, int mode) noexcept
+        {
+            using namespace Antiderivative;
+            constexpr double tolerance = 1.0e-3;   // second differences amplify rounding by 1/Δ²
+
+            if (mode != cachedMode)
+                primeCache(mode);
+
+            for (int i = 0; i < numSamples; ++i)
+            {
+                const double x0 = data[i];
+                const double F0 = f2(x0, mode);
+                const double dx = x0 - x1;
+                const double d0 = std::abs(dx) < tolerance ? f1(0.5 * (x0 + x1), mode)
+                                                           : (F0 - F2x1) / dx;
+                const double span = x0 - x2;
+                double y;
+
+                if (std::abs(span) >= tolerance)
+                {
+                    y = 2.0 * (d0 - d1) / span;
+                }
+                else
+                {
+                    // x[n] ≈ x[n-2]: expand around their mean instead
+                    const double xBar  = 0.5 * (x0 + x2);
+                    const double delta = xBar - x1;
+
+                    y = std::abs(delta) < tolerance
+                          ? f0(0.5 * (xBar + x1), mode)
+                          : (2.0 / delta) * (f1(xBar, mode) + (F2x1 - f2(xBar, mode)) / delta);
+                }
+
+                data[i] = (SampleType) y;
+                x2   = x1;
+                x1   = x0;
+                F2x1 = F0;
+                d1   = d0;
+            }
+        }
+
+    private:
+        void primeCache(int mode) noexcept
+        {
+            F1x1 = Antiderivative::f1(x1, mode);
+            F2x1 = Antiderivative::f2(x1, mode);
+
+            const double dx = x1 - x2;
+            d1 = std::abs(dx) < 1.0e-3 ? Antiderivative::f1(0.5 * (x1 + x2), mode)
+                                       : (F2x1 - Antiderivative::f2(x2, mode)) / dx;
+            cachedMode = mode;
+        }
+
+        double x1 = 0.0, x2 = 0.0;        // input history
+        double F1x1 = 0.0, F2x1 = 0.0;    // antiderivatives at x[n-1]
+        double d1 = 0.0;                  // previous divided difference (second order)
+        int cachedMode = -1;
+    };
+}
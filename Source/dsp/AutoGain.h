@@ -0,0 +1,161 @@
+#pragma once
+#include "Waveshapers.h"
+
+/**
+ * Auto-gain compensation for the saturation stage.
+ *
+ * The compensation gain is env / |f(env · drive)|.  Substituting
+ * u = env · drive gives  g(u) / drive  with  g(u) = u / |f(u)|,  a single
+ * one-dimensional curve per mode that does not depend on drive.  Those
+ * curves are tabulated once per process (CompensationTables, shared via
+ * juce::SharedResourcePointer) and read at control rate by each instance.
+ */
+namespace EnzoGainDSP
+{
+    /** g(u) = u / |f(u)| for every saturation mode, built from the exact curves.
+        Read-only after construction, so any number of audio threads may share it. */
+    class CompensationTables
+    {
+    public:
+        static constexpr int   pointsPerUnit = 64;     // grid hits u = 1 exactly (clip / fold knee)
+        static constexpr float maxInput      = 16.0f;  // beyond this every curve is saturated: g(u) = u
+        static constexpr int   tableSize     = (int) maxInput * pointsPerUnit + 2;   // + guard point
+
+        CompensationTables()
+        {
+            for (int mode = 1; mode <= 4; ++mode)
+            {
+                auto& table = tables[(size_t) mode - 1];
+
+                for (int i = 0; i < tableSize; ++i)
+                {
+                    const double u = (double) i / pointsPerUnit;
+
+                    // Fold uses the bounded peak estimate min(u, 1), avoiding
+                    // compensation spikes at the fold's zero crossings
+                    const double driven = mode == 4 ? juce::jmin(u, 1.0)
+                                                    : std::abs((double) Waveshaper::reference((float) u, mode));
+
+                    table[(size_t) i] = i == 0 ? 1.0f : (float) (u / driven);   // g(0⁺) = 1 for every curve
+                }
+            }
+        }
+
+        /** Linearly interpolated g(u) for u ≥ 0.  Mode 0 (Off) is the identity
+            curve, g = 1, which still matters while the mix ramps out. */
+        float lookup(int mode, float u) const noexcept
+        {
+            if (mode <= 0)
+                return 1.0f;
+
+            if (u >= maxInput)
+                return u;
+
+            const auto& table = tables[(size_t) juce::jmin(mode, 4) - 1];
+            const float position = u * (float) pointsPerUnit;
+            const int   index = (int) position;
+            const float frac  = position - (float) index;
+
+            return table[(size_t) index] + frac * (table[(size_t) index + 1] - table[(size_t) index]);
+        }
+
+    private:
+        std::array<std::array<float, (size_t) tableSize>, 4> tables;
+
+        JUCE_DECLARE_NON_COPYABLE(CompensationTables)
+    };
+
+    /**
+     * Peak-envelope follower plus control-rate compensation gain.
+     *
+     * The envelope still follows every sample (5 ms attack catches
+     * transients), but the gain is looked up only every controlInterval
+     * samples and linearly interpolated in between, continuous across blocks.
+     */
+    class AutoGainCompensator
+    {
+    public:
+        static constexpr int controlInterval = 32;
+
+        //   5 ms attack  — fast enough to catch transients
+        // 150 ms release — slow enough to avoid pumping
+        static constexpr double attackSeconds  = 0.005;
+        static constexpr double releaseSeconds = 0.150;
+
+        // Below this envelope the compensation gain is unity
+        static constexpr float envelopeFloor = 0.002f;
+
+        /** Time for a full-scale envelope to release below envelopeFloor. */
+        static double getReleaseTimeSeconds() noexcept
+        {
+            return releaseSeconds * std::log(1.0 / envelopeFloor);
+        }
+
+        void prepare(double sampleRate) noexcept
+        {
+            attackCoeff  = 1.0f - static_cast<float>(std::exp(-1.0 / (sampleRate * attackSeconds)));
+            releaseCoeff = 1.0f - static_cast<float>(std::exp(-1.0 / (sampleRate * releaseSeconds)));
+            reset();
+        }
+
+        void reset() noexcept
+        {
+            envelope = 0.0f;
+            current = target = 1.0f;
+            step = 0.0f;
+            samplesToNextPoint = 0;
+        }
+
+        float getEnvelope() const noexcept { return envelope; }
+
+        /** Envelope released and the gain back at unity: reset() changes nothing audible. */
+        bool isReleased() const noexcept
+        {
+            return envelope <= envelopeFloor && current == 1.0f && target == 1.0f;
+        }
+
+        /** peakInCompOut holds the detector input and receives the gain.
+            The follower itself runs in float for either sample type. */
+        template <typename SampleType>
+        void process(SampleType* peakInCompOut, const SampleType* drive, int numSamples, int mode,
+                     const CompensationTables& tables) noexcept
+        {
+            int i = 0;
+
+            while (i < numSamples)
+            {
+                if (samplesToNextPoint == 0)
+                    startSegment((float) drive[i], mode, tables);
+
+                const int n = juce::jmin(samplesToNextPoint, numSamples - i);
+
+                for (int k = 0; k < n; ++k)
+                {
+                    const float peak = (float) peakInCompOut[i + k];
+                    envelope += (peak > envelope ? attackCoeff : releaseCoeff) * (peak - envelope);
+                    peakInCompOut[i + k] = (SampleType) (current + step * (float) k);
+                }
+
+                current += step * (float) n;
+                samplesToNextPoint -= n;
+                i += n;
+            }
+        }
+
+    private:
+        void startSegment(float drive, int mode, const CompensationTables& tables) noexcept
+        {
+            current = target;
+            target = envelope > envelopeFloor
+                       ? juce::jlimit(0.1f, 4.0f, tables.lookup(mode, envelope * drive) / drive)
+                       : 1.0f;
+            step = (target - current) / (float) controlInterval;
+            samplesToNextPoint = controlInterval;
+        }
+
+        float attackCoeff = 0.0f, releaseCoeff = 0.0f;
+        float envelope = 0.0f;
+        float current = 1.0f, target = 1.0f, step = 0.0f;
+        int samplesToNextPoint = 0;
+    };
+}
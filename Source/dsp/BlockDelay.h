@@ -0,0 +1,87 @@
+#pragma once
+#include <juce_audio_basics/juce_audio_basics.h>
+
+/**
+ * Integer-sample multichannel delay that works a block at a time.
+ *
+ * Used to keep the dry path (and every channel that is not oversampled)
+ * aligned with the latency the processor reports to the host.  Reads and
+ * writes are plain ring-buffer copies — at most two memcpys per direction.
+ */
+namespace EnzoGainDSP
+{
+    template <typename SampleType>
+    class BlockDelay
+    {
+    public:
+        void prepare(int numChannels, int maxDelaySamples, int maxBlockSize)
+        {
+            ring.setSize(juce::jmax(1, numChannels), maxDelaySamples + maxBlockSize);
+            maxDelay = maxDelaySamples;
+            reset();
+        }
+
+        void reset() noexcept
+        {
+            ring.clear();
+            writePos = 0;
+        }
+
+        /** Changing the delay clears the history so no stale audio is replayed. */
+        void setDelay(int newDelay) noexcept
+        {
+            newDelay = juce::jlimit(0, maxDelay, newDelay);
+            if (newDelay != delay)
+            {
+                delay = newDelay;
+                reset();
+            }
+        }
+
+        int getDelay() const noexcept { return delay; }
+
+        /** Delays numSamples of every channel in place, starting at startSample. */
+        void process(juce::AudioBuffer<SampleType>& buffer, int startSample, int numSamples) noexcept
+        {
+            if (delay == 0)
+                return;
+
+            const int size = ring.getNumSamples();
+            jassert(numSamples <= size - delay);
+
+            const int readPos = (writePos - delay + size) % size;
+            const int numChannels = juce::jmin(buffer.getNumChannels(), ring.getNumChannels());
+
+            for (int channel = 0; channel < numChannels; ++channel)
+            {
+                SampleType* io = buffer.getWritePointer(channel, startSample);
+                SampleType* r  = ring.getWritePointer(channel);
+
+                copyIn(r, size, writePos, io, numSamples);
+                copyOut(io, r, size, readPos, numSamples);
+            }
+
+            writePos = (writePos + numSamples) % size;
+        }
+
+    private:
+        static void copyIn(SampleType* ringData, int size, int pos, const SampleType* src, int num) noexcept
+        {
+            const int first = juce::jmin(num, size - pos);
+            juce::FloatVectorOperations::copy(ringData + pos, src, first);
+            juce::FloatVectorOperations::copy(ringData, src + first, num - first);
+        }
+
+        static void copyOut(SampleType* dest, const SampleType* ringData, int size, int pos, int num) noexcept
+        {
+            const int first = juce::jmin(num, size - pos);
+            juce::FloatVectorOperations::copy(dest, ringData + pos, first);
+            juce::FloatVectorOperations::copy(dest + first, ringData, num - first);
+        }
+
+        juce::AudioBuffer<SampleType> ring;
+        int maxDelay = 0;
+        int delay    = 0;
+        int writePos = 0;
+    };
+}
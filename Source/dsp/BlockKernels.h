@@ -0,0 +1,153 @@
+#pragma once
+#include <juce_audio_basics/juce_audio_basics.h>
+
+/**
+ * Block-level building blocks for EnzoGainAudioProcessor::processBlock.
+ *
+ * Every stage works on whole contiguous sample arrays so the element-wise
+ * work goes through juce::FloatVectorOperations (SSE on x86, NEON on ARM)
+ * or through plain branch-free loops that the compiler auto-vectorises
+ * (AVX/AVX2 when ENZOGAIN_ENABLE_AVX2 is set at configure time).
+ *
+ * Only genuinely recursive work (smoothers, envelope follower) stays serial.
+ *
+ * The helpers are templated on the sample type so the float and double
+ * processBlock paths share them.  Smoothers stay SmoothedValue<float>; their
+ * ramps are widened as they are written out.
+ */
+namespace EnzoGainDSP
+{
+    // ── Smoothing ramps ──────────────────────────────────────────────────
+
+    /** Writes the next numSamples values of a SmoothedValue into dest.
+        Settled smoothers become a single vectorised fill. */
+    template <typename SampleType>
+    inline void renderRamp(juce::SmoothedValue<float>& smoother, SampleType* dest, int numSamples) noexcept
+    {
+        if (! smoother.isSmoothing())
+        {
+            juce::FloatVectorOperations::fill(dest, (SampleType) smoother.getTargetValue(), numSamples);
+            return;
+        }
+
+        for (int i = 0; i < numSamples; ++i)
+            dest[i] = (SampleType) smoother.getNextValue();
+    }
+
+    // ── Equal-power pan law ──────────────────────────────────────────────
+
+    /** Converts a pan ramp (-1 … +1) into left/right equal-power gains.
+        A settled pan is evaluated once and filled, not once per sample. */
+    template <typename SampleType>
+    inline void renderPanGains(const SampleType* pan, SampleType* left, SampleType* right,
+                               int numSamples, bool panIsRamping) noexcept
+    {
+        constexpr SampleType quarterPi = SampleType(0.25) * juce::MathConstants<SampleType>::pi;
+
+        if (! panIsRamping)
+        {
+            const SampleType angle = (pan[0] + SampleType(1)) * quarterPi;
+            juce::FloatVectorOperations::fill(left,  std::cos(angle), numSamples);
+            juce::FloatVectorOperations::fill(right, std::sin(angle), numSamples);
+            return;
+        }
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const SampleType angle = (pan[i] + SampleType(1)) * quarterPi;
+            left[i]  = std::cos(angle);
+            right[i] = std::sin(angle);
+        }
+    }
+
+    /** Surround balance law, min(1, √2 · cos / sin) of the equal-power
+        angle.  Written as cos x ∓ sin x of the offset from centre, so both
+        sides are exactly unity at centre in either precision and the far
+        side fades out while the near side holds. */
+    template <typename SampleType>
+    inline void balanceGains(SampleType pan, SampleType& left, SampleType& right) noexcept
+    {
+        const SampleType x = pan * SampleType(0.25) * juce::MathConstants<SampleType>::pi;
+        const SampleType c = std::cos(x), s = std::sin(x);
+
+        left  = juce::jlimit(SampleType(0), SampleType(1), c - s);
+        right = juce::jlimit(SampleType(0), SampleType(1), c + s);
+    }
+
+    /** renderPanGains for surround beds: balanceGains of a pan ramp. */
+    template <typename SampleType>
+    inline void renderBalanceGains(const SampleType* pan, SampleType* left, SampleType* right,
+                                   int numSamples, bool panIsRamping) noexcept
+    {
+        if (! panIsRamping)
+        {
+            SampleType l, r;
+            balanceGains(pan[0], l, r);
+            juce::FloatVectorOperations::fill(left,  l, numSamples);
+            juce::FloatVectorOperations::fill(right, r, numSamples);
+            return;
+        }
+
+        for (int i = 0; i < numSamples; ++i)
+            balanceGains(pan[i], left[i], right[i]);
+    }
+
+    /** Multiplies a channel by a constant gain; unity is a no-op and
+        silence is a clear, so a neutral setting costs nothing. */
+    template <typename SampleType>
+    inline void applyConstantGain(SampleType* data, SampleType gain, int numSamples) noexcept
+    {
+        if (gain == SampleType(1))
+            return;
+
+        if (gain == SampleType(0))
+            juce::FloatVectorOperations::clear(data, numSamples);
+        else
+            juce::FloatVectorOperations::multiply(data, gain, numSamples);
+    }
+
+    // ── Silence detection ────────────────────────────────────────────────
+
+    /** True when every channel stays within ±threshold.  One vectorised
+        min / max scan per channel, stopping at the first one that is not. */
+    template <typename SampleType>
+    inline bool isSilent(const SampleType* const* channels, int numChannels, int numSamples,
+                         SampleType threshold) noexcept
+    {
+        for (int c = 0; c < numChannels; ++c)
+        {
+            const auto range = juce::FloatVectorOperations::findMinAndMax(channels[c], numSamples);
+
+            if (range.getStart() < -threshold || range.getEnd() > threshold)
+                return false;
+        }
+
+        return true;
+    }
+
+    // ── Saturation helpers ───────────────────────────────────────────────
+
+    /** dest[i] = max over channels of |channels[c][i]| — the linked peak
+        detector input for one envelope group (numChannels ≥ 1). */
+    template <typename SampleType>
+    inline void peakDetect(SampleType* dest, const SampleType* const* channels, int numChannels,
+                           SampleType* scratch, int numSamples) noexcept
+    {
+        juce::FloatVectorOperations::abs(dest, channels[0], numSamples);
+
+        for (int c = 1; c < numChannels; ++c)
+        {
+            juce::FloatVectorOperations::abs(scratch, channels[c], numSamples);
+            juce::FloatVectorOperations::max(dest, dest, scratch, numSamples);
+        }
+    }
+
+    /** Crossfades a channel in place between its dry signal and a wet buffer:
+        io = io + mix * (wet - io).  wet is clobbered. */
+    template <typename SampleType>
+    inline void crossfade(SampleType* io, SampleType* wet, const SampleType* mix, int numSamples) noexcept
+    {
+        juce::FloatVectorOperations::subtract(wet, io, numSamples);
+        juce::FloatVectorOperations::addWithMultiply(io, wet, mix, numSamples);
+    }
+}
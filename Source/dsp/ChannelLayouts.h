@@ -0,0 +1,137 @@
+#pragma once
+#include <juce_audio_basics/juce_audio_basics.h>
+
+/**
+ * Per-channel pan / gain law and saturation linking for every supported
+ * bus layout.
+ *
+ *   Layout                  Pan law                           Envelopes
+ *   mono                    gain only                         one
+ *   stereo                  equal-power L/R                   L+R linked
+ *   LCR, 5.1, 7.1, 7.1.4    balance, min(1, √2·cos/sin):      ear level linked,
+ *                           every left channel takes the L    height layer linked,
+ *                           gain, every right channel the R   LFE on its own
+ *                           gain, both unity at centre;
+ *                           centre line channels (C, LFE)
+ *                           gain only
+ *   ambisonic (1st–3rd)     gain only (rotation-invariant)    all components linked
+ *
+ * A linked group shares one peak detector and one auto-gain curve, so the
+ * image inside the group does not shift as the saturation bites.
+ *
+ * The plan is built once per prepareToPlay from the bus layout; the
+ * processor's multichannel kernel only reads the tables below.  Channels
+ * past the plan (a host buffer wider than the bus) get gain only.
+ */
+namespace EnzoGainDSP
+{
+    enum class PanSide : uint8_t
+    {
+        none = 0,   // gain only
+        left,
+        right
+    };
+
+    class ChannelPlan
+    {
+    public:
+        static constexpr int maxChannels       = 16;   // third-order ambisonics
+        static constexpr int maxEnvelopeGroups = 3;
+
+        enum EnvelopeGroup
+        {
+            earLevelGroup = 0,   // also the only group for mono, stereo and ambisonics
+            heightGroup,
+            lfeGroup
+        };
+
+        /** True for the bus layouts listed above. */
+        static bool isSupported(const juce::AudioChannelSet& layout)
+        {
+            using Set = juce::AudioChannelSet;
+
+            if (layout == Set::mono() || layout == Set::stereo() || layout == Set::createLCR()
+                 || layout == Set::create5point1() || layout == Set::create7point1()
+                 || layout == Set::create7point1point4())
+                return true;
+
+            const int order = layout.getAmbisonicOrder();
+            return order >= 1 && order <= 3 && layout == Set::ambisonic(order);
+        }
+
+        void build(const juce::AudioChannelSet& layout)
+        {
+            numChannels = juce::jmin(layout.size(), maxChannels);
+            jassert(layout.size() <= maxChannels);
+
+            const bool ambisonic = layout.getAmbisonicOrder() >= 0;
+            sided = false;
+
+            for (int channel = 0; channel < numChannels; ++channel)
+            {
+                const auto type = layout.getTypeOfChannel(channel);
+
+                sides[(size_t) channel]  = ambisonic ? PanSide::none : sideOf(type);
+                groups[(size_t) channel] = ambisonic ? earLevelGroup : groupOf(type);
+                sided = sided || sides[(size_t) channel] != PanSide::none;
+            }
+        }
+
+        int getNumChannels() const noexcept              { return numChannels; }
+        bool hasSidedChannels() const noexcept           { return sided; }
+
+        PanSide getSide(int channel) const noexcept
+        {
+            return channel < numChannels ? sides[(size_t) channel] : PanSide::none;
+        }
+
+        int getEnvelopeGroup(int channel) const noexcept { return groups[(size_t) channel]; }
+
+    private:
+        static PanSide sideOf(juce::AudioChannelSet::ChannelType type) noexcept
+        {
+            using Set = juce::AudioChannelSet;
+
+            switch (type)
+            {
+                case Set::left:            case Set::leftSurround:      case Set::leftCentre:
+                case Set::leftSurroundSide: case Set::leftSurroundRear: case Set::wideLeft:
+                case Set::topFrontLeft:    case Set::topRearLeft:       case Set::topSideLeft:
+                    return PanSide::left;
+
+                case Set::right:           case Set::rightSurround:     case Set::rightCentre:
+                case Set::rightSurroundSide: case Set::rightSurroundRear: case Set::wideRight:
+                case Set::topFrontRight:   case Set::topRearRight:      case Set::topSideRight:
+                    return PanSide::right;
+
+                default:
+                    return PanSide::none;
+            }
+        }
+
+        static int groupOf(juce::AudioChannelSet::ChannelType type) noexcept
+        {
+            using Set = juce::AudioChannelSet;
+
+            switch (type)
+            {
+                case Set::LFE: case Set::LFE2:
+                    return lfeGroup;
+
+                case Set::topMiddle:
+                case Set::topFrontLeft: case Set::topFrontCentre: case Set::topFrontRight:
+                case Set::topRearLeft:  case Set::topRearCentre:  case Set::topRearRight:
+                case Set::topSideLeft:  case Set::topSideRight:
+                    return heightGroup;
+
+                default:
+                    return earLevelGroup;
+            }
+        }
+
+        std::array<PanSide, maxChannels> sides {};
+        std::array<int, maxChannels> groups {};
+        int numChannels = 0;
+        bool sided = false;
+    };
+}
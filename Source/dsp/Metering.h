@@ -0,0 +1,140 @@
+#pragma once
+#include <juce_audio_basics/juce_audio_basics.h>
+#include "ChannelLayouts.h"
+
+/**
+ * Level metering from the audio thread to the editor.
+ *
+ * The audio thread folds every block into a MeterAccumulator and publishes
+ * one MeterFrame per frameInterval samples into a wait-free single-producer
+ * / single-consumer MeterFifo.  Frames are produced at a fixed rate in
+ * audio time, so the number of frames (and the UI work behind them) does
+ * not grow as the host buffer shrinks.  The editor drains the FIFO on its
+ * own timer.
+ *
+ * Nothing here locks or allocates after prepare().
+ */
+namespace EnzoGainDSP
+{
+    struct MeterFrame
+    {
+        static constexpr int maxChannels = ChannelPlan::maxChannels;
+
+        float peak[maxChannels];   // linear max |x| over the frame
+        float rms[maxChannels];    // linear RMS over the frame
+        float satComp;             // auto-gain compensation at frame end (1 = none)
+        float effectiveGain;       // smoothed gain × LFO modulation at frame end
+        int   numChannels;
+    };
+
+    class MeterFifo
+    {
+    public:
+        static constexpr int capacity = 64;   // ≈ 1 s of frames; AbstractFifo keeps one slot free
+
+        /** Audio thread.  Drops the frame when the consumer has fallen behind. */
+        bool push(const MeterFrame& frame) noexcept
+        {
+            int start1, size1, start2, size2;
+            fifo.prepareToWrite(1, start1, size1, start2, size2);
+
+            if (size1 == 0)
+                return false;
+
+            frames[(size_t) start1] = frame;
+            fifo.finishedWrite(1);
+            return true;
+        }
+
+        /** Message thread.  Copies up to maxFrames of the oldest frames into dest. */
+        int pop(MeterFrame* dest, int maxFrames) noexcept
+        {
+            int start1, size1, start2, size2;
+            fifo.prepareToRead(maxFrames, start1, size1, start2, size2);
+
+            std::copy_n(frames.begin() + start1, size1, dest);
+            std::copy_n(frames.begin() + start2, size2, dest + size1);
+
+            fifo.finishedRead(size1 + size2);
+            return size1 + size2;
+        }
+
+        /** Message thread: drops everything pending. */
+        void clear() noexcept
+        {
+            fifo.finishedRead(fifo.getNumReady());
+        }
+
+    private:
+        juce::AbstractFifo fifo { capacity };
+        std::array<MeterFrame, capacity> frames;
+    };
+
+    class MeterAccumulator
+    {
+    public:
+        static constexpr double framesPerSecond = 60.0;
+
+        void prepare(double sampleRate) noexcept
+        {
+            frameInterval = juce::jmax(1, juce::roundToInt(sampleRate / framesPerSecond));
+            reset();
+        }
+
+        void reset() noexcept
+        {
+            std::fill(std::begin(peak), std::end(peak), 0.0f);
+            std::fill(std::begin(sumSquares), std::end(sumSquares), 0.0);
+            numAccumulated = 0;
+        }
+
+        /** Audio thread: adds one block; pushes a frame into fifo once per frameInterval. */
+        template <typename SampleType>
+        void addBlock(const SampleType* const* channels, int numChannels, int numSamples,
+                      float satComp, float effectiveGain, MeterFifo& fifo) noexcept
+        {
+            if (numSamples <= 0)
+                return;
+
+            numChannels = juce::jmin(numChannels, MeterFrame::maxChannels);
+
+            for (int channel = 0; channel < numChannels; ++channel)
+            {
+                const SampleType* data = channels[channel];
+                const auto range = juce::FloatVectorOperations::findMinAndMax(data, numSamples);
+
+                SampleType squares = 0;
+                for (int i = 0; i < numSamples; ++i)
+                    squares += data[i] * data[i];
+
+                peak[channel] = juce::jmax(peak[channel], (float) juce::jmax(-range.getStart(), range.getEnd()));
+                sumSquares[channel] += (double) squares;
+            }
+
+            numAccumulated += numSamples;
+
+            if (numAccumulated < frameInterval)
+                return;
+
+            MeterFrame frame;
+            frame.numChannels   = numChannels;
+            frame.satComp       = satComp;
+            frame.effectiveGain = effectiveGain;
+
+            for (int channel = 0; channel < numChannels; ++channel)
+            {
+                frame.peak[channel] = peak[channel];
+                frame.rms[channel]  = (float) std::sqrt(sumSquares[channel] / numAccumulated);
+            }
+
+            fifo.push(frame);
+            reset();
+        }
+
+    private:
+        float  peak[MeterFrame::maxChannels] {};
+        double sumSquares[MeterFrame::maxChannels] {};
+        int    numAccumulated = 0;
+        int    frameInterval  = 735;
+    };
+}
@@ -0,0 +1,100 @@
+#pragma once
+#include <juce_core/juce_core.h>
+
+/**
+ * Timestamped parameter changes for sample-accurate automation.
+ *
+ * One lock-free single-producer / single-consumer FIFO per automatable
+ * parameter.  Producers (a host-side wrapper with queue offsets, an offline
+ * renderer, the UI) push plain parameter values stamped with an absolute
+ * position on the processor's sample timeline; the audio thread consumes
+ * them in order and splits the block at every change point.
+ *
+ * Positions must be non-decreasing per lane.  An event stamped before the
+ * current block applies at its first sample.
+ */
+namespace EnzoGainDSP
+{
+    template <int NumLanes>
+    class ParameterEventQueue
+    {
+    public:
+        static constexpr int capacity = 512;   // per lane; AbstractFifo keeps one slot free
+
+        /** Producer side (one thread per lane).  Returns false when the lane is full. */
+        bool push(int lane, juce::int64 position, float value) noexcept
+        {
+            jassert(juce::isPositiveAndBelow(lane, NumLanes));
+            auto& l = lanes[(size_t) lane];
+
+            int start1, size1, start2, size2;
+            l.fifo.prepareToWrite(1, start1, size1, start2, size2);
+
+            if (size1 == 0)
+                return false;
+
+            l.events[(size_t) start1] = { position, value };
+            l.fifo.finishedWrite(1);
+            return true;
+        }
+
+        /** Consumer side: applies every event at or before position to values[lane]. */
+        void applyUpTo(juce::int64 position, float* values) noexcept
+        {
+            for (int lane = 0; lane < NumLanes; ++lane)
+            {
+                auto& l = lanes[(size_t) lane];
+
+                while (const auto* event = head(l))
+                {
+                    if (event->position > position)
+                        break;
+
+                    values[lane] = event->value;
+                    l.fifo.finishedRead(1);
+                }
+            }
+        }
+
+        /** Consumer side: position of the earliest pending event, or the largest int64. */
+        juce::int64 nextPosition() const noexcept
+        {
+            auto next = std::numeric_limits<juce::int64>::max();
+
+            for (const auto& l : lanes)
+                if (const auto* event = head(l))
+                    next = juce::jmin(next, event->position);
+
+            return next;
+        }
+
+        /** Consumer side: drops everything pending (timeline restart). */
+        void clear() noexcept
+        {
+            for (auto& l : lanes)
+                l.fifo.finishedRead(l.fifo.getNumReady());
+        }
+
+    private:
+        struct Event
+        {
+            juce::int64 position;
+            float value;
+        };
+
+        struct Lane
+        {
+            juce::AbstractFifo fifo { capacity };
+            std::array<Event, capacity> events;
+        };
+
+        static const Event* head(const Lane& l) noexcept
+        {
+            int start1, size1, start2, size2;
+            l.fifo.prepareToRead(1, start1, size1, start2, size2);
+            return size1 > 0 ? &l.events[(size_t) start1] : nullptr;
+        }
+
+        std::array<Lane, (size_t) NumLanes> lanes;
+    };
+}
@@ -0,0 +1,360 @@
+#pragma once
+#include <juce_core/juce_core.h>
+
+/**
+ * Optional hot-path instrumentation, compiled in with ENZOGAIN_PROFILING=1.
+ *
+ * processBlock laps a StageClock at every pipeline stage boundary and, at
+ * the end of the call, pushes one ProfileRecord (per-stage ticks, block
+ * size, isNonRealtime() and deadline budget) into the instance's
+ * wait-free ProfileFifo.  A ProfileDumper thread drains the FIFO every
+ * dumpIntervalMs, appends Chrome trace events to a file in the temp
+ * directory (open it in ui.perfetto.dev or chrome://tracing) and keeps a
+ * rolling mean / p99 per stage for the editor.
+ *
+ * The types are always declared; with ENZOGAIN_PROFILING at 0 the
+ * processor holds none of them and its probes expand to nothing.
+ */
+namespace EnzoGainDSP
+{
+    enum class ProfileStage
+    {
+        smoothing = 0,   // parameter ramps
+        lfo,             // LFO render into the gain lane
+        gainPan,         // pan law and the final gain / pan multiply (and the settled path)
+        saturation,      // drive, dry delay, oversampling and waveshaper
+        envelope,        // peak detector, auto-gain and dry / wet crossfade
+        numStages
+    };
+
+    constexpr int numProfileStages = (int) ProfileStage::numStages;
+
+    inline const char* getStageName(int stage) noexcept
+    {
+        static const char* const names[] = { "smoothing", "lfo", "gain/pan", "saturation", "envelope" };
+        return names[stage];
+    }
+
+    struct ProfileRecord
+    {
+        juce::int64  startTicks;
+        juce::int64  totalTicks;
+        juce::int64  budgetTicks;                    // numSamples at the current sample rate
+        juce::uint32 stageTicks[numProfileStages];
+        int          numSamples;
+        bool         nonRealtime;
+    };
+
+    /** Audio thread: accumulates stage time across the chunks of one block. */
+    class StageClock
+    {
+    public:
+        static juce::int64 now() noexcept { return juce::Time::getHighResolutionTicks(); }
+
+        void beginBlock() noexcept
+        {
+            record = {};
+            record.startTicks = last = now();
+        }
+
+        void begin() noexcept { last = now(); }
+
+        void lap(ProfileStage stage) noexcept
+        {
+            const auto time = now();
+            record.stageTicks[(int) stage] += (juce::uint32) (time - last);
+            last = time;
+        }
+
+        const ProfileRecord& endBlock(int numSamples, bool nonRealtime, double ticksPerSample) noexcept
+        {
+            record.totalTicks  = now() - record.startTicks;
+            record.budgetTicks = (juce::int64) (numSamples * ticksPerSample);
+            record.numSamples  = numSamples;
+            record.nonRealtime = nonRealtime;
+            return record;
+        }
+
+    private:
+        ProfileRecord record {};
+        juce::int64 last = 0;
+    };
+
+    class ProfileFifo
+    {
+    public:
+        static constexpr int capacity = 4096;   // > 1 s of 16-sample blocks at 48 kHz
+
+        /** Audio thread.  Drops the record when the dumper has fallen behind. */
+        bool push(const ProfileRecord& record) noexcept
+        {
+            int start1, size1, start2, size2;
+            fifo.prepareToWrite(1, start1, size1, start2, size2);
+
+            if (size1 == 0)
+                return false;
+
+            records[(size_t) start1] = record;
+            fifo.finishedWrite(1);
+            return true;
+        }
+
+        int pop(ProfileRecord* dest, int maxRecords) noexcept
+        {
+            int start1, size1, start2, size2;
+            fifo.prepareToRead(maxRecords, start1, size1, start2, size2);
+
+            std::copy_n(records.begin() + start1, size1, dest);
+            std::copy_n(records.begin() + start2, size2, dest + size1);
+
+            fifo.finishedRead(size1 + size2);
+            return size1 + size2;
+        }
+
+    private:
+        juce::AbstractFifo fifo { capacity };
+        std::array<ProfileRecord, capacity> records;
+    };
+
+    /** Rolling statistics over the last ProfileDumper::windowSize blocks. */
+    struct ProfileSummary
+    {
+        float meanMicros[numProfileStages];
+        float p99Micros[numProfileStages];
+        float meanBlockMicros;
+        float p99BlockMicros;
+        float meanHeadroom;    // 1 − block time / budget, realtime blocks only
+        float minHeadroom;
+        int   numBlocks;       // in the window
+        int   numNonRealtime;  // of those, rendered offline
+        int   sequence;        // bumped on every update
+    };
+
+    class ProfileDumper : private juce::Thread
+    {
+    public:
+        static constexpr int dumpIntervalMs = 100;
+        static constexpr int windowSize     = 4096;
+        static constexpr juce::int64 maxTraceBytes = 256 * 1024 * 1024;   // stats go on after that
+
+        ProfileDumper(ProfileFifo& source, int instanceId)
+            : juce::Thread("EnzoGain profile dumper"), fifo(source), instance(instanceId),
+              microsPerTick(1.0e6 / (double) juce::Time::getHighResolutionTicksPerSecond())
+        {
+            traceFile = juce::File::getSpecialLocation(juce::File::tempDirectory)
+                            .getChildFile("EnzoGain-profile-" + juce::Time::getCurrentTime().formatted("%Y%m%d-%H%M%S")
+                                          + "-" + juce::String(instanceId) + ".json");
+
+            for (auto& column : window)
+                column.resize((size_t) windowSize);
+
+            startThread(juce::Thread::Priority::background);
+        }
+
+        ~ProfileDumper() override
+        {
+            stopThread(2000);
+
+            // Close the array so strict JSON readers accept the file too
+            if (trace != nullptr)
+            {
+                trace->writeText("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" + juce::String(instance)
+                                 + ",\"args\":{\"name\":\"EnzoGain #" + juce::String(instance) + "\"}}\n]\n",
+                                 false, false, nullptr);
+            }
+        }
+
+        juce::File getTraceFile() const { return traceFile; }
+
+        /** Any non-audio thread: the newest statistics; false before the first block. */
+        bool getSummary(ProfileSummary& dest) const
+        {
+            const juce::SpinLock::ScopedLockType lock(summaryLock);
+
+            if (summary.numBlocks == 0)
+                return false;
+
+            dest = summary;
+            return true;
+        }
+
+    private:
+        // Rolling columns: one per stage, then block time, then headroom
+        enum { blockColumn = numProfileStages, headroomColumn, numColumns };
+
+        void run() override
+        {
+            while (! threadShouldExit())
+            {
+                drain();
+                wait(dumpIntervalMs);
+            }
+
+            drain();
+        }
+
+        void drain()
+        {
+            int numRecords = 0;
+            bool any = false;
+
+            while ((numRecords = fifo.pop(batch.data(), (int) batch.size())) > 0)
+            {
+                any = true;
+
+                for (int i = 0; i < numRecords; ++i)
+                {
+                    writeTrace(batch[(size_t) i]);
+                    addToWindow(batch[(size_t) i]);
+                }
+            }
+
+            if (any)
+            {
+                if (trace != nullptr)
+                    trace->flush();
+
+                publishSummary();
+            }
+        }
+
+        // Chrome trace events, JSON array format.  Stages are drawn end to end
+        // inside their block in pipeline order: their summed time per block,
+        // since the chunks of one block interleave them.  Timestamps are
+        // absolute high-resolution ticks, so the files of several instances
+        // can be loaded together.
+        void writeTrace(const ProfileRecord& record)
+        {
+            if (trace == nullptr && ! traceFailed)
+            {
+                trace = traceFile.createOutputStream();
+                traceFailed = trace == nullptr;
+
+                if (trace != nullptr)
+                    trace->writeText("[\n", false, false, nullptr);
+            }
+
+            if (trace == nullptr || trace->getPosition() > maxTraceBytes)
+                return;
+
+            const double start = (double) record.startTicks * microsPerTick;
+            const double duration = (double) record.totalTicks * microsPerTick;
+            const double headroom = record.budgetTicks > 0 ? 1.0 - (double) record.totalTicks / (double) record.budgetTicks : 0.0;
+            const auto tid = juce::String(instance);
+
+            juce::String events;
+            events << "{\"name\":\"processBlock\",\"cat\":\"EnzoGain\",\"ph\":\"X\",\"pid\":1,\"tid\":" << tid
+                   << ",\"ts\":" << juce::String(start, 3) << ",\"dur\":" << juce::String(duration, 3)
+                   << ",\"args\":{\"samples\":" << record.numSamples
+                   << ",\"nonRealtime\":" << (record.nonRealtime ? "true" : "false")
+                   << ",\"headroom\":" << juce::String(headroom, 4) << "}},\n";
+
+            double cursor = start;
+
+            for (int stage = 0; stage < numProfileStages; ++stage)
+            {
+                if (record.stageTicks[stage] == 0)
+                    continue;
+
+                const double stageDuration = (double) record.stageTicks[stage] * microsPerTick;
+
+                events << "{\"name\":\"" << getStageName(stage) << "\",\"cat\":\"EnzoGain\",\"ph\":\"X\",\"pid\":1,\"tid\":" << tid
+                       << ",\"ts\":" << juce::String(cursor, 3) << ",\"dur\":" << juce::String(stageDuration, 3) << "},\n";
+
+                cursor += stageDuration;
+            }
+
+            events << "{\"name\":\"headroom\",\"ph\":\"C\",\"pid\":1,\"tid\":" << tid
+                   << ",\"ts\":" << juce::String(start, 3) << ",\"args\":{\"headroom\":" << juce::String(headroom, 4) << "}},\n";
+
+            trace->writeText(events, false, false, nullptr);
+        }
+
+        void addToWindow(const ProfileRecord& record)
+        {
+            const auto slot = (size_t) (numRecorded % windowSize);
+
+            for (int stage = 0; stage < numProfileStages; ++stage)
+                window[(size_t) stage][slot] = (float) (record.stageTicks[stage] * microsPerTick);
+
+            window[blockColumn][slot] = (float) (record.totalTicks * microsPerTick);
+
+            // Offline renders have no deadline; keep them out of the headroom
+            window[headroomColumn][slot] = record.nonRealtime || record.budgetTicks <= 0
+                                               ? std::numeric_limits<float>::quiet_NaN()
+                                               : (float) (1.0 - (double) record.totalTicks / (double) record.budgetTicks);
+
+            nonRealtime[slot] = record.nonRealtime;
+            ++numRecorded;
+        }
+
+        void publishSummary()
+        {
+            const int count = (int) juce::jmin((juce::int64) windowSize, numRecorded);
+            ProfileSummary next {};
+
+            auto meanAndP99 = [this, count] (int column, float& mean, float& p99)
+            {
+                sorted.assign(window[(size_t) column].begin(), window[(size_t) column].begin() + count);
+
+                double sum = 0.0;
+                for (auto value : sorted)
+                    sum += value;
+
+                const auto rank = sorted.begin() + juce::jmin(count - 1, (int) (0.99 * count));
+                std::nth_element(sorted.begin(), rank, sorted.end());
+
+                mean = (float) (sum / count);
+                p99  = *rank;
+            };
+
+            for (int stage = 0; stage < numProfileStages; ++stage)
+                meanAndP99(stage, next.meanMicros[stage], next.p99Micros[stage]);
+
+            meanAndP99(blockColumn, next.meanBlockMicros, next.p99BlockMicros);
+
+            double headroomSum = 0.0;
+            int headroomCount = 0;
+            next.minHeadroom = 1.0f;
+
+            for (int i = 0; i < count; ++i)
+            {
+                const float headroom = window[headroomColumn][(size_t) i];
+
+                if (std::isnan(headroom))
+                    continue;
+
+                headroomSum += headroom;
+                ++headroomCount;
+                next.minHeadroom = juce::jmin(next.minHeadroom, headroom);
+            }
+
+            next.meanHeadroom   = headroomCount > 0 ? (float) (headroomSum / headroomCount) : 1.0f;
+            next.numBlocks      = count;
+            next.numNonRealtime = (int) std::count(nonRealtime.begin(), nonRealtime.begin() + count, true);
+
+            const juce::SpinLock::ScopedLockType lock(summaryLock);
+            next.sequence = summary.sequence + 1;
+            summary = next;
+        }
+
+        ProfileFifo& fifo;
+        const int instance;
+        const double microsPerTick;
+
+        juce::File traceFile;
+        std::unique_ptr<juce::FileOutputStream> trace;
+        bool traceFailed = false;
+
+        std::array<ProfileRecord, 256> batch;
+        std::array<std::vector<float>, numColumns> window;
+        std::array<bool, windowSize> nonRealtime {};
+        std::vector<float> sorted;
+        juce::int64 numRecorded = 0;
+
+        juce::SpinLock summaryLock;
+        ProfileSummary summary {};
+
+        JUCE_DECLARE_NON_COPYABLE(ProfileDumper)
+    };
+}
@@ -0,0 +1,102 @@
+#pragma once
+#include <juce_core/juce_core.h>
+
+/**
+ * Audio snapshots from the audio thread to the analyser thread.
+ *
+ * The audio thread writes a mono mix of each block into a power-of-two
+ * ring; it never waits for, or even knows about, the reader.  A seqlock
+ * on two running sample counts: before touching the ring the writer
+ * claims the range up to its block's end, and after it publishes that
+ * end as written.  The analyser thread copies the newest N written
+ * samples whenever it wants a snapshot, at its own rate, then discards
+ * the copy if any claim made since — finished or still in progress, of
+ * any block size — reaches the positions it copied.
+ *
+ * Audio-thread cost is one multiply-add per channel and sample into the ring;
+ * nothing locks or allocates after construction.
+ */
+namespace EnzoGainDSP
+{
+    class SnapshotRing
+    {
+    public:
+        static constexpr int capacity = 16384;   // 4 × the analyser window
+        static constexpr int mask     = capacity - 1;
+
+        SnapshotRing() : samples((size_t) capacity, 0.0f) {}
+
+        /** Call while the audio thread is stopped (prepareToPlay). */
+        void prepare(double newSampleRate) noexcept
+        {
+            sampleRate.store(newSampleRate, std::memory_order_relaxed);
+            claimed.store(0, std::memory_order_relaxed);
+            written.store(0, std::memory_order_release);
+        }
+
+        double getSampleRate() const noexcept { return sampleRate.load(std::memory_order_relaxed); }
+
+        /** Audio thread: appends the mean of numChannels channels. */
+        template <typename SampleType>
+        void write(const SampleType* const* channels, int numChannels, int numSamples) noexcept
+        {
+            if (numChannels <= 0 || numSamples <= 0)
+                return;
+
+            // Only the newest capacity samples can ever be read
+            const int skip = juce::jmax(0, numSamples - capacity);
+            const auto start = written.load(std::memory_order_relaxed) + skip;
+            const float scale = 1.0f / (float) numChannels;
+
+            // Claim before the first sample store: a reader that sees any of
+            // this block's samples then also sees the claim
+            claimed.store(start + numSamples - skip, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+
+            for (int done = skip; done < numSamples;)
+            {
+                const int position = (int) ((start + done - skip) & mask);
+                const int count = juce::jmin(numSamples - done, capacity - position);
+                float* dest = samples.data() + position;
+
+                for (int i = 0; i < count; ++i)
+                    dest[i] = scale * (float) channels[0][done + i];
+
+                for (int channel = 1; channel < numChannels; ++channel)
+                    for (int i = 0; i < count; ++i)
+                        dest[i] += scale * (float) channels[channel][done + i];
+
+                done += count;
+            }
+
+            written.store(start + numSamples - skip, std::memory_order_release);
+        }
+
+        /** Analyser thread: copies the newest numSamples into dest.  False if
+            fewer have been written yet or a write claimed any of the copied
+            positions before the copy was done. */
+        bool readLatest(float* dest, int numSamples) const noexcept
+        {
+            jassert(numSamples <= capacity / 2);
+
+            const auto end = written.load(std::memory_order_acquire);
+
+            if (end < numSamples)
+                return false;
+
+            const int position = (int) ((end - numSamples) & mask);
+            const int first = juce::jmin(numSamples, capacity - position);
+
+            std::copy_n(samples.data() + position, first, dest);
+            std::copy_n(samples.data(), numSamples - first, dest + first);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return claimed.load(std::memory_order_relaxed) - (end - numSamples) <= capacity;
+        }
+
+    private:
+        std::vector<float> samples;
+        std::atomic<juce::int64> claimed { 0 }, written { 0 };
+        std::atomic<double> sampleRate { 44100.0 };
+    };
+}
@@ -0,0 +1,221 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include <juce_dsp/juce_dsp.h>
+#include "SnapshotRing.h"
+
+/**
+ * Spectrum / oscilloscope analysis on a background thread.
+ *
+ * About framesPerSecond times a second the thread takes the newest
+ * fftSize samples from each SnapshotRing, runs a Hann-windowed FFT and
+ * reduces it to numBands log-spaced bands (dBFS of a full-scale sine),
+ * plus a peak-preserving numScopePoints oscilloscope trace of the output.
+ * The editor picks up the newest frame on the message thread; frames it
+ * misses are simply replaced.
+ *
+ * All FFT work, allocation and locking stay off the audio thread, which
+ * only writes the rings.
+ */
+namespace EnzoGainDSP
+{
+    struct AnalyserFrame
+    {
+        static constexpr int numBands       = 96;
+        static constexpr int numScopePoints = 128;
+
+        float output[numBands];          // dBFS, floorDb … 0+
+        float input[numBands];           // dBFS of the input tap, when hasInput
+        float scope[numScopePoints];     // output waveform, -1 … +1 at full scale
+        float minHz;                     // centre of band 0
+        float maxHz;                     // centre of band numBands - 1
+        bool  hasInput;
+    };
+
+    class SpectrumAnalyser : private juce::Thread
+    {
+    public:
+        static constexpr int fftOrder = 12;
+        static constexpr int fftSize  = 1 << fftOrder;
+        static constexpr float floorDb = -100.0f;
+
+        SpectrumAnalyser(const SnapshotRing& outputRing, const SnapshotRing& inputRing)
+            : juce::Thread("EnzoGain analyser"), output(outputRing), input(inputRing)
+        {
+        }
+
+        ~SpectrumAnalyser() override { stop(); }
+
+        /** Message thread.  The input tap is analysed only when analyseInput is set. */
+        void start(int framesPerSecond, bool analyseInput)
+        {
+            intervalMs.store(juce::jmax(1, 1000 / framesPerSecond), std::memory_order_relaxed);
+            inputEnabled.store(analyseInput, std::memory_order_relaxed);
+
+            if (! isThreadRunning())
+                startThread(juce::Thread::Priority::low);
+        }
+
+        void stop()                                  { stopThread(1000); }
+        void setInputEnabled(bool analyseInput) noexcept { inputEnabled.store(analyseInput, std::memory_order_relaxed); }
+
+        /** Message thread: copies the newest frame; false if none since the last call. */
+        bool getLatestFrame(AnalyserFrame& dest)
+        {
+            const juce::SpinLock::ScopedLockType lock(frameLock);
+
+            if (! frameIsNew)
+                return false;
+
+            dest = latest;
+            frameIsNew = false;
+            return true;
+        }
+
+    private:
+        void run() override
+        {
+            while (! threadShouldExit())
+            {
+                analyse();
+                wait(intervalMs.load(std::memory_order_relaxed));
+            }
+        }
+
+        void analyse()
+        {
+            const double sampleRate = output.getSampleRate();
+
+            if (sampleRate != bandSampleRate)
+                buildBands(sampleRate);
+
+            if (! output.readLatest(snapshot.data(), fftSize))
+                return;
+
+            renderScope();
+            renderBands(smoothedOutput);
+
+            const bool withInput = inputEnabled.load(std::memory_order_relaxed)
+                                    && input.readLatest(snapshot.data(), fftSize);
+
+            if (withInput)
+                renderBands(smoothedInput);
+
+            const juce::SpinLock::ScopedLockType lock(frameLock);
+
+            for (int band = 0; band < AnalyserFrame::numBands; ++band)
+            {
+                working.output[band] = toDecibels(smoothedOutput[(size_t) band]);
+                working.input[band]  = withInput ? toDecibels(smoothedInput[(size_t) band]) : floorDb;
+            }
+
+            working.hasInput = withInput;
+            latest = working;
+            frameIsNew = true;
+        }
+
+        // Log-spaced band centres and edges in (fractional) FFT bins
+        void buildBands(double sampleRate)
+        {
+            bandSampleRate = sampleRate;
+
+            const double binHz = sampleRate / fftSize;
+            const double lowHz = 20.0;
+            const double highHz = juce::jmin(20000.0, 0.45 * sampleRate);
+            const double ratio = std::pow(highHz / lowHz, 1.0 / (AnalyserFrame::numBands - 1));
+            const double halfStep = std::sqrt(ratio);
+
+            for (int band = 0; band < AnalyserFrame::numBands; ++band)
+            {
+                const double centre = lowHz * std::pow(ratio, band);
+                bandCentre[(size_t) band] = (float) (centre / binHz);
+                bandLow[(size_t) band]  = (int) std::ceil(centre / halfStep / binHz);
+                bandHigh[(size_t) band] = (int) std::floor(centre * halfStep / binHz);
+            }
+
+            working.minHz = (float) lowHz;
+            working.maxHz = (float) highHz;
+
+            std::fill(smoothedOutput.begin(), smoothedOutput.end(), 0.0f);
+            std::fill(smoothedInput.begin(), smoothedInput.end(), 0.0f);
+        }
+
+        // Windowed FFT of snapshot → per-band magnitude, averaged over frames.
+        // A band narrower than a bin reads the interpolated magnitude at its
+        // centre; a wider one the largest bin it covers.
+        void renderBands(std::array<float, AnalyserFrame::numBands>& smoothed)
+        {
+            std::copy(snapshot.begin(), snapshot.end(), fftData.begin());
+            window.multiplyWithWindowingTable(fftData.data(), (size_t) fftSize);
+            fft.performFrequencyOnlyForwardTransform(fftData.data(), true);
+
+            // Hann coherent gain is 0.5: a full-scale sine peaks at fftSize / 4
+            const float normalise = 4.0f / fftSize;
+            constexpr float smoothing = 0.5f;
+
+            for (int band = 0; band < AnalyserFrame::numBands; ++band)
+            {
+                const float centre = bandCentre[(size_t) band];
+                const int bin = juce::jlimit(0, fftSize / 2 - 1, (int) centre);
+                const float fraction = centre - (float) bin;
+                float magnitude = fftData[(size_t) bin] + fraction * (fftData[(size_t) bin + 1] - fftData[(size_t) bin]);
+
+                for (int i = bandLow[(size_t) band]; i <= juce::jmin(bandHigh[(size_t) band], fftSize / 2); ++i)
+                    magnitude = juce::jmax(magnitude, fftData[(size_t) i]);
+
+                auto& value = smoothed[(size_t) band];
+                value = smoothing * value + (1.0f - smoothing) * magnitude * normalise;
+            }
+        }
+
+        // The signed sample of largest magnitude in each scope slot
+        void renderScope()
+        {
+            constexpr int perPoint = fftSize / 2 / AnalyserFrame::numScopePoints;
+            const float* source = snapshot.data() + fftSize / 2;   // newest half
+
+            for (int point = 0; point < AnalyserFrame::numScopePoints; ++point)
+            {
+                float extreme = 0.0f;
+
+                for (int i = 0; i < perPoint; ++i)
+                {
+                    const float sample = source[point * perPoint + i];
+                    if (std::abs(sample) > std::abs(extreme))
+                        extreme = sample;
+                }
+
+                working.scope[point] = extreme;
+            }
+        }
+
+        static float toDecibels(float magnitude) noexcept
+        {
+            return juce::Decibels::gainToDecibels(magnitude, floorDb);
+        }
+
+        const SnapshotRing& output;
+        const SnapshotRing& input;
+
+        std::atomic<bool> inputEnabled { false };
+        std::atomic<int> intervalMs { 33 };
+
+        juce::dsp::FFT fft { fftOrder };
+        juce::dsp::WindowingFunction<float> window { (size_t) fftSize, juce::dsp::WindowingFunction<float>::hann, false };
+
+        std::array<float, fftSize> snapshot {};
+        std::array<float, 2 * fftSize> fftData {};
+
+        double bandSampleRate = 0.0;
+        std::array<float, AnalyserFrame::numBands> bandCentre {};
+        std::array<int, AnalyserFrame::numBands> bandLow {}, bandHigh {};
+        std::array<float, AnalyserFrame::numBands> smoothedOutput {}, smoothedInput {};
+
+        AnalyserFrame working {};
+
+        juce::SpinLock frameLock;
+        AnalyserFrame latest {};
+        bool frameIsNew = false;
+
+        JUCE_DECLARE_NON_COPYABLE(SpectrumAnalyser)
+    };
+}
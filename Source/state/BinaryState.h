@@ -0,0 +1,109 @@
+#pragma once
+#include <juce_core/juce_core.h>
+
+/**
+ * EnzoGain's compact binary plugin state.
+ *
+ *   offset  size  field
+ *   0       4     magic "EGST"
+ *   4       2     schema version (currentVersion)
+ *   6       2     number of entries
+ *   8       4     flags (Flags)
+ *   12      8·n   entries: FNV-1a hash of the parameter ID, plain value (float)
+ *
+ * All fields little-endian.  Entries are matched by ID hash, so parameters
+ * can be added, removed or reordered without a new schema version; an
+ * unknown hash is skipped.  Loading parses nothing but this fixed layout.
+ *
+ * Blobs that do not start with the magic are the XML state of earlier
+ * versions (copyXmlToBinary's own header).
+ */
+namespace EnzoGainState
+{
+    constexpr juce::uint32 magic          = 0x54534745;   // "EGST" read as little-endian
+    constexpr juce::uint16 currentVersion = 1;
+    constexpr int headerSize = 12;
+    constexpr int entrySize  = 8;
+
+    enum Flags : juce::uint32
+    {
+        nativeEditor = 1u << 0   // EditorMode::native
+    };
+
+    struct Entry
+    {
+        juce::uint32 idHash;
+        float value;             // denormalised, as the parameter's range shows it
+    };
+
+    constexpr juce::uint32 hashParameterID(const char* id) noexcept
+    {
+        juce::uint32 hash = 2166136261u;
+
+        for (; *id != 0; ++id)
+            hash = (hash ^ (juce::uint8) *id) * 16777619u;
+
+        return hash;
+    }
+
+    inline bool isBinaryState(const void* data, int sizeInBytes) noexcept
+    {
+        return data != nullptr && sizeInBytes >= headerSize
+            && juce::ByteOrder::littleEndianInt(data) == magic;
+    }
+
+    inline void write(juce::MemoryBlock& dest, const Entry* entries, int numEntries, juce::uint32 flags)
+    {
+        dest.setSize((size_t) (headerSize + numEntries * entrySize));
+        auto* bytes = static_cast<char*>(dest.getData());
+
+        auto put32 = [&bytes](juce::uint32 value) {
+            value = juce::ByteOrder::swapIfBigEndian(value);
+            std::memcpy(bytes, &value, 4);
+            bytes += 4;
+        };
+
+        put32(magic);
+        put32((juce::uint32) currentVersion | ((juce::uint32) numEntries << 16));
+        put32(flags);
+
+        for (int i = 0; i < numEntries; ++i)
+        {
+            juce::uint32 value;
+            std::memcpy(&value, &entries[i].value, 4);
+
+            put32(entries[i].idHash);
+            put32(value);
+        }
+    }
+
+    /** Calls apply(idHash, value) for every entry.  False, having called
+        nothing, for a truncated blob or one written by a newer schema. */
+    template <typename Callback>
+    bool read(const void* data, int sizeInBytes, juce::uint32& flags, Callback&& apply)
+    {
+        if (! isBinaryState(data, sizeInBytes))
+            return false;
+
+        const auto* bytes = static_cast<const char*>(data);
+        const auto versionAndCount = juce::ByteOrder::littleEndianInt(bytes + 4);
+        const auto version = (juce::uint16) (versionAndCount & 0xffff);
+        const int numEntries = (int) (versionAndCount >> 16);
+
+        if (version > currentVersion || sizeInBytes < headerSize + numEntries * entrySize)
+            return false;
+
+        flags = juce::ByteOrder::littleEndianInt(bytes + 8);
+
+        for (const char* entry = bytes + headerSize; entry < bytes + headerSize + numEntries * entrySize; entry += entrySize)
+        {
+            const auto bits = juce::ByteOrder::littleEndianInt(entry + 4);
+            float value;
+            std::memcpy(&value, &bits, 4);
+
+            apply(juce::ByteOrder::littleEndianInt(entry), value);
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,239 @@
+#pragma once
+#include <juce_audio_processors/juce_audio_processors.h>
+
+/**
+ * Batched parameter traffic between the WebView page and the processor.
+ *
+ * Host → page: parameter changes (host automation, state recall, the
+ * native editor) only store the new normalised value and a dirty flag, so
+ * they are safe from the audio thread.  The editor calls takeChanges() once
+ * per UI tick while it is showing and sends the result as one "parameters"
+ * event: an object of parameter ID → normalised value holding only what
+ * differs from what the page last saw.
+ *
+ * Page → host: the page queues its edits for an animation frame and sends
+ * them as one batch, { inputs, begin: [ids], values: { id: value },
+ * end: [ids] }, applied by applyBatch() in that order.  A value outside a
+ * begin / end pair is applied as a complete gesture of its own.  Values the
+ * page set are not echoed back to it.
+ *
+ * Message thread only, apart from the parameter listener.
+ */
+namespace EnzoGainUI
+{
+    class ParameterBridge : private juce::AudioProcessorParameter::Listener
+    {
+    public:
+        struct Stats
+        {
+            juce::int64 hostChanges;       // parameter change notifications seen
+            juce::int64 hostValuesSent;    // values sent to the page
+            juce::int64 hostEvents;        // "parameters" events sent
+            juce::int64 pageChanges;       // edits made in the page
+            juce::int64 pageValuesApplied; // values set on parameters
+            juce::int64 pageBatches;       // batches received
+        };
+
+        ParameterBridge(juce::AudioProcessorValueTreeState& state, std::initializer_list<const char*> parameterIDs)
+        {
+            for (const auto* id : parameterIDs)
+            {
+                auto* parameter = state.getParameter(id);
+                jassert(parameter != nullptr);
+
+                auto entry = std::make_unique<Entry>();
+                entry->id        = id;
+                entry->parameter = parameter;
+                entry->value     = parameter->getValue();
+                entry->lastSent  = entry->value.load();
+                entries.push_back(std::move(entry));
+
+                parameter->addListener(this);
+            }
+        }
+
+        ~ParameterBridge() override
+        {
+            for (auto& entry : entries)
+            {
+                entry->parameter->removeListener(this);
+
+                // The page went away mid-drag
+                if (entry->inGesture)
+                    entry->parameter->endChangeGesture();
+            }
+        }
+
+        /** Every value, for the page's initial state, marking them all as sent.
+            Once the loaded page has asked, takeChanges() starts reporting. */
+        juce::var getSnapshot(bool pageLoaded)
+        {
+            juce::DynamicObject::Ptr values = new juce::DynamicObject();
+
+            for (auto& entry : entries)
+            {
+                entry->dirty = false;
+                entry->lastSent = entry->value.load();
+                values->setProperty(entry->id, toJson(entry->lastSent));
+            }
+
+            pageReady = pageReady || pageLoaded;
+            return juce::var(values.get());
+        }
+
+        /** The values that changed since the last call, or void if none did
+            (or the page has not asked for its snapshot yet). */
+        juce::var takeChanges()
+        {
+            if (! pageReady)
+                return {};
+
+            juce::DynamicObject::Ptr values;
+
+            for (auto& entry : entries)
+            {
+                if (! entry->dirty.exchange(false))
+                    continue;
+
+                const float value = entry->value.load();
+
+                if (value == entry->lastSent)
+                    continue;
+
+                if (values == nullptr)
+                    values = new juce::DynamicObject();
+
+                values->setProperty(entry->id, toJson(value));
+                entry->lastSent = value;
+                ++hostValuesSent;
+            }
+
+            if (values == nullptr)
+                return {};
+
+            ++hostEvents;
+            return juce::var(values.get());
+        }
+
+        void applyBatch(const juce::var& batch)
+        {
+            if (! batch.isObject())
+                return;
+
+            ++pageBatches;
+            pageChanges += (int) batch.getProperty("inputs", 0);
+
+            const auto begins = batch.getProperty("begin", {});
+            const auto values = batch.getProperty("values", {});
+            const auto ends   = batch.getProperty("end", {});
+
+            if (auto* ids = begins.getArray())
+            {
+                for (const auto& id : *ids)
+                {
+                    if (auto* entry = find(id.toString()); entry != nullptr && ! entry->inGesture)
+                    {
+                        entry->inGesture = true;
+                        entry->parameter->beginChangeGesture();
+                    }
+                }
+            }
+
+            if (auto* object = values.getDynamicObject())
+            {
+                for (const auto& property : object->getProperties())
+                {
+                    if (auto* entry = find(property.name.toString()))
+                        apply(*entry, (float) property.value);
+                }
+            }
+
+            if (auto* ids = ends.getArray())
+            {
+                for (const auto& id : *ids)
+                {
+                    if (auto* entry = find(id.toString()); entry != nullptr && entry->inGesture)
+                    {
+                        entry->inGesture = false;
+                        entry->parameter->endChangeGesture();
+                    }
+                }
+            }
+        }
+
+        Stats getStats() const noexcept
+        {
+            return { hostChanges.load(), hostValuesSent, hostEvents, pageChanges, pageValuesApplied, pageBatches };
+        }
+
+    private:
+        struct Entry
+        {
+            juce::String id;
+            juce::RangedAudioParameter* parameter = nullptr;
+            std::atomic<float> value { 0.0f };   // newest normalised value, any thread
+            std::atomic<bool> dirty { false };
+            float lastSent = 0.0f;               // what the page shows
+            bool inGesture = false;
+        };
+
+        // Whole-step and 0.1 % parameters need nowhere near float precision on the wire
+        static double toJson(float value) { return std::round((double) value * 1.0e6) / 1.0e6; }
+
+        Entry* find(const juce::String& id) const
+        {
+            for (auto& entry : entries)
+                if (entry->id == id)
+                    return entry.get();
+
+            return nullptr;
+        }
+
+        void apply(Entry& entry, float normalised)
+        {
+            auto& parameter = *entry.parameter;
+            const float value = parameter.convertTo0to1(parameter.convertFrom0to1(juce::jlimit(0.0f, 1.0f, normalised)));
+
+            // The page already shows this value; don't send it back
+            entry.lastSent = value;
+            ++pageValuesApplied;
+
+            if (entry.inGesture)
+            {
+                parameter.setValueNotifyingHost(value);
+            }
+            else
+            {
+                parameter.beginChangeGesture();
+                parameter.setValueNotifyingHost(value);
+                parameter.endChangeGesture();
+            }
+        }
+
+        void parameterValueChanged(int parameterIndex, float newValue) override
+        {
+            hostChanges.fetch_add(1, std::memory_order_relaxed);
+
+            for (auto& entry : entries)
+            {
+                if (entry->parameter->getParameterIndex() == parameterIndex)
+                {
+                    entry->value = newValue;
+                    entry->dirty = true;
+                    return;
+                }
+            }
+        }
+
+        void parameterGestureChanged(int, bool) override {}
+
+        std::vector<std::unique_ptr<Entry>> entries;
+        bool pageReady = false;
+
+        std::atomic<juce::int64> hostChanges { 0 };
+        juce::int64 hostValuesSent = 0, hostEvents = 0;
+        juce::int64 pageChanges = 0, pageValuesApplied = 0, pageBatches = 0;
+
+        JUCE_DECLARE_NON_COPYABLE(ParameterBridge)
+    };
+}
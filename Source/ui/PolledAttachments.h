@@ -0,0 +1,219 @@
+#pragma once
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <juce_gui_basics/juce_gui_basics.h>
+
+/**
+ * Parameter attachments for the native editor that the audio thread never
+ * touches.
+ *
+ * JUCE's APVTS attachments listen to their parameter and, for a change made
+ * off the message thread — host automation, which the VST3 and AU wrappers
+ * deliver on the audio thread — post a message to the message queue, which
+ * locks it and writes to the event loop's pipe.  These keep no listener:
+ * the editor calls poll() on each of them once per UI tick, as the WebView
+ * editor takes ParameterBridge's changes, and a control shows a new value
+ * only when the parameter's differs from the one it last showed.  Edits
+ * made with a control go to the parameter as gestures, as JUCE's do.
+ *
+ * Message thread only.
+ */
+namespace EnzoGainUI
+{
+    /** One parameter and a callback that shows its value (in parameter
+        units) on a control; the same interface as juce::ParameterAttachment. */
+    class PolledAttachment
+    {
+    public:
+        PolledAttachment(juce::RangedAudioParameter& parameterToUse, std::function<void(float)> showValue)
+            : parameter(parameterToUse), setControl(std::move(showValue))
+        {
+        }
+
+        virtual ~PolledAttachment() = default;
+
+        /** Shows the parameter's value if it changed since the last poll. */
+        void poll()
+        {
+            const float value = parameter.getValue();
+
+            if (juce::exactlyEqual(value, lastShown))
+                return;
+
+            lastShown = value;
+
+            const juce::ScopedValueSetter<bool> showing(updatingControl, true);
+            setControl(parameter.convertFrom0to1(value));
+        }
+
+        /** Shows the current value whether or not it changed. */
+        void sendInitialUpdate()
+        {
+            lastShown = -1.0f;
+            poll();
+        }
+
+        void beginGesture() { parameter.beginChangeGesture(); }
+        void endGesture()   { parameter.endChangeGesture(); }
+
+        /** A control edit, in parameter units, inside begin / endGesture(). */
+        void setValueAsPartOfGesture(float newValue)
+        {
+            if (updatingControl)
+                return;
+
+            const float normalised = parameter.convertTo0to1(newValue);
+
+            if (! juce::exactlyEqual(normalised, parameter.getValue()))
+                parameter.setValueNotifyingHost(normalised);
+
+            lastShown = parameter.getValue();
+        }
+
+        /** A control edit that is a whole gesture by itself (a click). */
+        void setValueAsCompleteGesture(float newValue)
+        {
+            if (updatingControl)
+                return;
+
+            beginGesture();
+            setValueAsPartOfGesture(newValue);
+            endGesture();
+        }
+
+    protected:
+        juce::RangedAudioParameter& parameter;
+
+    private:
+        std::function<void(float)> setControl;
+        float lastShown = -1.0f;       // normalised; never a parameter value
+        bool updatingControl = false;  // the control's own callbacks are ours
+
+        JUCE_DECLARE_NON_COPYABLE(PolledAttachment)
+    };
+
+    /** A slider over the parameter's range, text and default, as
+        juce::AudioProcessorValueTreeState::SliderAttachment sets it up. */
+    class PolledSliderAttachment : public PolledAttachment,
+                                   private juce::Slider::Listener
+    {
+    public:
+        PolledSliderAttachment(juce::AudioProcessorValueTreeState& state, const juce::String& parameterID, juce::Slider& sliderToUse)
+            : PolledAttachment(*state.getParameter(parameterID),
+                               [this](float value) { slider.setValue(value, juce::sendNotificationSync); }),
+              slider(sliderToUse)
+        {
+            auto& ranged = parameter;
+
+            slider.valueFromTextFunction = [&ranged](const juce::String& text)
+            {
+                return (double) ranged.convertFrom0to1(ranged.getValueForText(text));
+            };
+            slider.textFromValueFunction = [&ranged](double value)
+            {
+                return ranged.getText(ranged.convertTo0to1((float) value), 0);
+            };
+            slider.setDoubleClickReturnValue(true, ranged.convertFrom0to1(ranged.getDefaultValue()));
+
+            // The float range, with its own mapping and snapping, over doubles
+            auto range = ranged.getNormalisableRange();
+
+            juce::NormalisableRange<double> sliderRange
+            {
+                (double) range.start, (double) range.end,
+                [range](double start, double end, double normalised) mutable
+                {
+                    range.start = (float) start;
+                    range.end = (float) end;
+                    return (double) range.convertFrom0to1((float) normalised);
+                },
+                [range](double start, double end, double value) mutable
+                {
+                    range.start = (float) start;
+                    range.end = (float) end;
+                    return (double) range.convertTo0to1((float) value);
+                },
+                [range](double start, double end, double value) mutable
+                {
+                    range.start = (float) start;
+                    range.end = (float) end;
+                    return (double) range.snapToLegalValue((float) value);
+                }
+            };
+
+            sliderRange.interval = range.interval;
+            sliderRange.skew = range.skew;
+            sliderRange.symmetricSkew = range.symmetricSkew;
+            slider.setNormalisableRange(sliderRange);
+
+            sendInitialUpdate();
+            slider.addListener(this);
+        }
+
+        ~PolledSliderAttachment() override { slider.removeListener(this); }
+
+    private:
+        void sliderValueChanged(juce::Slider*) override  { setValueAsPartOfGesture((float) slider.getValue()); }
+        void sliderDragStarted(juce::Slider*) override   { beginGesture(); }
+        void sliderDragEnded(juce::Slider*) override     { endGesture(); }
+
+        juce::Slider& slider;
+    };
+
+    /** A toggle button for a bool parameter. */
+    class PolledButtonAttachment : public PolledAttachment,
+                                   private juce::Button::Listener
+    {
+    public:
+        PolledButtonAttachment(juce::AudioProcessorValueTreeState& state, const juce::String& parameterID, juce::Button& buttonToUse)
+            : PolledAttachment(*state.getParameter(parameterID),
+                               [this](float value) { button.setToggleState(value >= 0.5f, juce::sendNotificationSync); }),
+              button(buttonToUse)
+        {
+            sendInitialUpdate();
+            button.addListener(this);
+        }
+
+        ~PolledButtonAttachment() override { button.removeListener(this); }
+
+    private:
+        void buttonClicked(juce::Button*) override
+        {
+            setValueAsCompleteGesture(button.getToggleState() ? 1.0f : 0.0f);
+        }
+
+        juce::Button& button;
+    };
+
+    /** A combo box whose item indices are the choice parameter's indices. */
+    class PolledComboBoxAttachment : public PolledAttachment,
+                                     private juce::ComboBox::Listener
+    {
+    public:
+        PolledComboBoxAttachment(juce::AudioProcessorValueTreeState& state, const juce::String& parameterID, juce::ComboBox& boxToUse)
+            : PolledAttachment(*state.getParameter(parameterID),
+                               [this](float value)
+                               {
+                                   const auto index = juce::roundToInt(parameter.convertTo0to1(value) * (float) (box.getNumItems() - 1));
+
+                                   if (index != box.getSelectedItemIndex())
+                                       box.setSelectedItemIndex(index, juce::sendNotificationSync);
+                               }),
+              box(boxToUse)
+        {
+            sendInitialUpdate();
+            box.addListener(this);
+        }
+
+        ~PolledComboBoxAttachment() override { box.removeListener(this); }
+
+    private:
+        void comboBoxChanged(juce::ComboBox*) override
+        {
+            const int numItems = box.getNumItems();
+            const float normalised = numItems > 1 ? (float) box.getSelectedItemIndex() / (float) (numItems - 1) : 0.0f;
+            setValueAsCompleteGesture(parameter.convertFrom0to1(normalised));
+        }
+
+        juce::ComboBox& box;
+    };
+}
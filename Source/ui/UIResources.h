@@ -0,0 +1,88 @@
+#pragma once
+#include <juce_gui_extra/juce_gui_extra.h>
+#include <string_view>
+#include <unordered_map>
+#include "BinaryData.h"
+#include "UIResourceTable.h"
+
+/**
+ * URL → embedded UI file lookup for the editor's resource provider.
+ *
+ * ENZOGAIN_UI_RESOURCES is generated by CMake from the same file list that
+ * feeds EnzoGain_UIResources.  It is resolved against BinaryData once per
+ * process into a hash map of pointers into the binary's read-only data, so
+ * a request costs one hash lookup plus the single copy that
+ * WebBrowserComponent::Resource needs to own its bytes.
+ */
+namespace EnzoGainUI
+{
+    class ResourceTable
+    {
+    public:
+        struct Entry
+        {
+            const char* data;
+            int         size;
+            const char* mimeType;
+        };
+
+        static const ResourceTable& get()
+        {
+            static const ResourceTable table;
+            return table;
+        }
+
+        /** The file served at url ("/" is index.html), or nullptr. */
+        const Entry* find(std::string_view url) const noexcept
+        {
+            url = url.substr(0, url.find_first_of("?#"));
+
+            if (url.empty() || url == "/")
+                url = "/index.html";
+
+            const auto found = entries.find(url);
+            return found != entries.end() ? &found->second : nullptr;
+        }
+
+        std::optional<juce::WebBrowserComponent::Resource> makeResource(const juce::String& url) const
+        {
+            const auto* entry = find(url.toRawUTF8());
+
+            if (entry == nullptr)
+                return std::nullopt;
+
+            const auto* bytes = reinterpret_cast<const std::byte*>(entry->data);
+
+            return juce::WebBrowserComponent::Resource {
+                std::vector<std::byte>(bytes, bytes + entry->size),
+                juce::String(entry->mimeType)
+            };
+        }
+
+    private:
+        ResourceTable()
+        {
+           #define ENZOGAIN_UI_ADD_RESOURCE(url, fileName, mimeType) add(url, fileName, mimeType);
+            ENZOGAIN_UI_RESOURCES(ENZOGAIN_UI_ADD_RESOURCE)
+           #undef ENZOGAIN_UI_ADD_RESOURCE
+        }
+
+        void add(const char* url, const char* fileName, const char* mimeType)
+        {
+            for (int i = 0; i < BinaryData::namedResourceListSize; ++i)
+            {
+                if (std::strcmp(BinaryData::originalFilenames[i], fileName) != 0)
+                    continue;
+
+                int size = 0;
+                const char* data = BinaryData::getNamedResource(BinaryData::namedResourceList[i], size);
+                entries.emplace(url, Entry { data, size, mimeType });
+                return;
+            }
+
+            jassertfalse;   // listed in ENZOGAIN_UI_FILES but not embedded
+        }
+
+        std::unordered_map<std::string_view, Entry> entries;
+    };
+}
@@ -0,0 +1,672 @@
+/*
+ * EnzoGainBatch: offline processing of audio files through EnzoGain.
+ *
+ * Every input file runs through a fresh headless EnzoGainAudioProcessor,
+ * set up from a saved state and / or individual parameter values, and is
+ * written to the output directory under the same name.  The output is
+ * what the plugin produces playing the file from its start in a host
+ * that restores the state, prepares it for --block samples at the file's
+ * sample rate and then calls processBlock with blocks starting at whole
+ * multiples of --block from the start of the file (single precision).
+ *
+ * Files stream through in chunks of whole blocks (about 64k frames), so
+ * memory does not grow with file length: WAV and AIFF are read through a
+ * memory-mapped window over the current chunk, FLAC through a buffered
+ * stream, and writes go through a 1 MB output buffer.  Files run in
+ * parallel, one per job; the processors are created and destroyed on the
+ * main (message) thread, only processing and file I/O run on the jobs.
+ *
+ * Reports, per file and in total, the audio processed, wall time and the
+ * realtime multiple (seconds of audio per second of wall time).
+ *
+ * Usage:
+ *   EnzoGainBatch [options] -o <dir> <file or directory>...
+ *
+ *   -o, --out <dir>         output directory (created if needed)
+ *   --state <file>          a state saved by the plugin (binary or XML blob),
+ *                           or an XML text file of its parameter tree
+ *   --set <ID>=<value>      a parameter in its displayed units or by choice
+ *                           name (GAIN=0.8, SAT_MODE=Tube); applied after
+ *                           --state, repeatable
+ *   --automate <ID>=<value>@<seconds>
+ *                           a sample-accurate change of GAIN, PAN, SAT_DRIVE,
+ *                           LFO_STRENGTH or LFO_FREQ at that time in each
+ *                           file (GAIN=0.5@2.25); repeatable, the parameter
+ *                           glides there over its usual smoothing time
+ *   --block <n>  (512)      --jobs <n>  (hardware threads)
+ *   --format wav|aiff|flac  (the input's)   --bits 16|24|32  (the input's)
+ *   --compensate-latency    drop the reported latency from the start and
+ *                           flush it at the end, as a delay-compensated
+ *                           bounce does
+ *   --overwrite             replace existing output files
+ *   --json
+ *
+ * Directories are searched (not recursively) for .wav, .aif, .aiff and
+ * .flac files.
+ */
+
+#include "PluginProcessor.h"
+
+#include <juce_audio_formats/juce_audio_formats.h>
+#include <juce_gui_basics/juce_gui_basics.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <map>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr int chunkFrames       = 65536;     // per read / process / write round, rounded up to whole blocks
+    constexpr int inputBufferBytes  = 1 << 20;   // streamed (non-mapped) readers
+    constexpr int outputBufferBytes = 1 << 20;
+
+    const juce::StringArray supportedExtensions { "wav", "aif", "aiff", "flac" };
+
+    /** One --automate point: a lane's plain value from a time in the file on. */
+    struct AutomationPoint
+    {
+        int lane;
+        double seconds;
+        float value;
+    };
+
+    struct Settings
+    {
+        juce::MemoryBlock state;          // applied to every file's processor
+        std::vector<AutomationPoint> automation;   // in time order
+        juce::File outputDirectory;
+        juce::String format;              // output extension, empty for the input's
+        int bitsPerSample = 0;            // 0 for the input's
+        int blockSize = 512;
+        bool compensateLatency = false;
+        bool overwrite = false;
+    };
+
+    // ── Settings ─────────────────────────────────────────────────────
+
+    /** A saved state blob as the plugin writes it, or XML text of the parameter tree. */
+    bool loadState(EnzoGainAudioProcessor& processor, const juce::File& file, juce::String& error)
+    {
+        juce::MemoryBlock data;
+
+        if (! file.loadFileAsData(data) || data.isEmpty())
+        {
+            error = "can't read state file " + file.getFullPathName();
+            return false;
+        }
+
+        if (! EnzoGainState::isBinaryState(data.getData(), (int) data.getSize()))
+        {
+            // setStateInformation ignores anything it doesn't recognise; say so here instead
+            auto xml = juce::AudioProcessor::getXmlFromBinary(data.getData(), (int) data.getSize());
+
+            if (xml == nullptr)
+                xml = juce::parseXML(data.toString());
+
+            if (xml == nullptr || ! xml->hasTagName(processor.parameters.state.getType()))
+            {
+                error = file.getFullPathName() + " is not an EnzoGain state";
+                return false;
+            }
+
+            data.reset();
+            juce::AudioProcessor::copyXmlToBinary(*xml, data);
+        }
+
+        processor.setStateInformation(data.getData(), (int) data.getSize());
+        return true;
+    }
+
+    /** "ID=value", the value in the parameter's own units, a choice name or on / off. */
+    bool setParameter(EnzoGainAudioProcessor& processor, const juce::String& assignment, juce::String& error)
+    {
+        const auto id   = assignment.upToFirstOccurrenceOf("=", false, false).trim();
+        const auto text = assignment.fromFirstOccurrenceOf("=", false, false).trim();
+        auto* parameter = processor.parameters.getParameter(id);
+
+        if (parameter == nullptr || text.isEmpty())
+        {
+            error = "--set " + assignment + ": expected <ID>=<value> with a parameter ID such as GAIN";
+            return false;
+        }
+
+        float normalised = 0.0f;
+
+        if (text.containsOnly("0123456789.-+eE"))
+        {
+            normalised = parameter->convertTo0to1(text.getFloatValue());
+        }
+        else if (auto* choice = dynamic_cast<juce::AudioParameterChoice*>(parameter))
+        {
+            const int index = choice->choices.indexOf(text, true);
+
+            if (index < 0)
+            {
+                error = "--set " + assignment + ": one of " + choice->choices.joinIntoString(", ");
+                return false;
+            }
+
+            normalised = parameter->convertTo0to1((float) index);
+        }
+        else if (dynamic_cast<juce::AudioParameterBool*>(parameter) != nullptr)
+        {
+            normalised = parameter->getValueForText(text);
+        }
+        else
+        {
+            error = "--set " + assignment + ": not a number";
+            return false;
+        }
+
+        parameter->setValueNotifyingHost(normalised);
+        return true;
+    }
+
+    /** "ID=value@seconds" for an automatable parameter, the value in its own
+        units (clamped and snapped to its range). */
+    bool parseAutomationPoint(EnzoGainAudioProcessor& processor, const juce::String& text,
+                              AutomationPoint& point, juce::String& error)
+    {
+        const auto id    = text.upToFirstOccurrenceOf("=", false, false).trim();
+        const auto value = text.fromFirstOccurrenceOf("=", false, false).upToFirstOccurrenceOf("@", false, false).trim();
+        const auto time  = text.fromFirstOccurrenceOf("@", false, false).trim();
+
+        point.lane = EnzoGainAudioProcessor::findAutomationLane(id);
+        auto* parameter = processor.parameters.getParameter(id);
+
+        if (point.lane < 0 || parameter == nullptr || value.isEmpty() || time.isEmpty()
+             || ! value.containsOnly("0123456789.-+eE") || ! time.containsOnly("0123456789.+eE"))
+        {
+            error = "--automate " + text + ": expected <ID>=<value>@<seconds> for GAIN, PAN, SAT_DRIVE,"
+                    " LFO_STRENGTH or LFO_FREQ";
+            return false;
+        }
+
+        point.value   = parameter->getNormalisableRange().snapToLegalValue(value.getFloatValue());
+        point.seconds = time.getDoubleValue();
+        return true;
+    }
+
+    /** The format's bit depth nearest below the one asked for, else its deepest. */
+    int chooseBitDepth(juce::AudioFormat& format, int wanted)
+    {
+        auto depths = format.getPossibleBitDepths();
+        std::sort(depths.begin(), depths.end());
+
+        int chosen = depths.isEmpty() ? wanted : depths.getLast();
+
+        for (const int depth : depths)
+            if (depth <= wanted)
+                chosen = depth;
+
+        return chosen;
+    }
+
+    // ── One file ─────────────────────────────────────────────────────
+
+    juce::File getOutputFile(const juce::File& input, const Settings& settings)
+    {
+        const auto extension = settings.format.isNotEmpty() ? "." + settings.format : input.getFileExtension();
+        return settings.outputDirectory.getChildFile(input.getFileNameWithoutExtension() + extension);
+    }
+
+    /** Reads chunks through a mapped window of the file where the format can, else from a buffered stream. */
+    class ChunkReader
+    {
+    public:
+        ChunkReader(juce::AudioFormat& format, const juce::File& file)
+        {
+            mapped.reset(format.createMemoryMappedReader(file));
+
+            if (mapped != nullptr)
+            {
+                reader = mapped.get();
+            }
+            else if (auto stream = file.createInputStream())
+            {
+                streamed.reset(format.createReaderFor(new juce::BufferedInputStream(stream.release(), inputBufferBytes, true),
+                                                      true));
+                reader = streamed.get();
+            }
+        }
+
+        juce::AudioFormatReader* get() const noexcept { return reader; }
+
+        bool read(juce::AudioBuffer<float>& buffer, juce::int64 start, int numFrames)
+        {
+            // Only the current chunk is mapped, so resident memory stays at about a chunk
+            if (mapped != nullptr && ! mapped->mapSectionOfFile({ start, start + numFrames }))
+                return false;
+
+            return reader->read(&buffer, 0, numFrames, start, true, true);
+        }
+
+    private:
+        std::unique_ptr<juce::MemoryMappedAudioFormatReader> mapped;
+        std::unique_ptr<juce::AudioFormatReader> streamed;
+        juce::AudioFormatReader* reader = nullptr;
+    };
+
+    struct FileJob
+    {
+        explicit FileJob(const juce::File& file) : input(file) {}
+
+        /** Main thread: reads the header, creates the output file and the processor. */
+        bool open(juce::AudioFormatManager& formats, const Settings& settings)
+        {
+            auto* inputFormat = formats.findFormatForFileExtension(input.getFileExtension());
+
+            if (inputFormat != nullptr)
+                reader = std::make_unique<ChunkReader>(*inputFormat, input);
+
+            if (reader == nullptr || reader->get() == nullptr)
+                return fail("not a readable audio file");
+
+            const auto& source = *reader->get();
+            sampleRate = source.sampleRate;
+            numFrames  = source.lengthInSamples;
+
+            // ── Processor, as a host would restore and prepare it ────────
+            const int numChannels = (int) source.numChannels;
+            const auto layout = juce::AudioChannelSet::canonicalChannelSet(numChannels);
+
+            juce::AudioProcessor::BusesLayout buses;
+            buses.inputBuses.add(layout);
+            buses.outputBuses.add(layout);
+
+            processor = std::make_unique<EnzoGainAudioProcessor>();
+
+            if (layout.isDisabled() || ! processor->setBusesLayout(buses))
+                return fail(juce::String(numChannels) + " channels: no channel layout EnzoGain supports");
+
+            processor->setStateInformation(settings.state.getData(), (int) settings.state.getSize());
+            processor->setNonRealtime(true);
+            processor->setRateAndBufferSizeDetails(sampleRate, settings.blockSize);
+            processor->prepareToPlay(sampleRate, settings.blockSize);
+
+            // ── Output ───────────────────────────────────────────────────
+            output = getOutputFile(input, settings);
+            auto* outputFormat = formats.findFormatForFileExtension(output.getFileExtension());
+
+            if (outputFormat == nullptr)
+                return fail("no writer for " + output.getFileExtension());
+
+            if (output == input)
+                return fail("output would replace the input");
+
+            if (output.exists() && ! (settings.overwrite && output.deleteFile()))
+                return fail(output.getFullPathName() + " exists (--overwrite replaces it)");
+
+            auto fileStream = std::make_unique<juce::FileOutputStream>(output, outputBufferBytes);
+
+            if (fileStream->failedToOpen())
+                return fail("can't create " + output.getFullPathName());
+
+            std::unique_ptr<juce::OutputStream> stream = std::move(fileStream);
+
+            auto options = juce::AudioFormatWriterOptions{}
+                               .withSampleRate(sampleRate)
+                               .withNumChannels(numChannels)
+                               .withBitsPerSample(chooseBitDepth(*outputFormat, settings.bitsPerSample > 0
+                                                                                    ? settings.bitsPerSample
+                                                                                    : (int) source.bitsPerSample));
+
+            if (outputFormat == inputFormat)
+                options = options.withMetadataValues(source.metadataValues);
+
+            writer = outputFormat->createWriterFor(stream, options);
+
+            if (writer == nullptr)
+            {
+                stream.reset();
+                output.deleteFile();
+                return fail(outputFormat->getFormatName() + " can't write this channel count / bit depth");
+            }
+
+            return true;
+        }
+
+        /** A pool thread: streams the file through the processor. */
+        void run(const Settings& settings)
+        {
+            const auto started = Clock::now();
+
+            const int numChannels = processor->getTotalNumInputChannels();
+            const int blockSize = settings.blockSize;
+            const int chunkSize = (chunkFrames + blockSize - 1) / blockSize * blockSize;
+
+            // The latency's worth of output is dropped from the start and
+            // rendered from silence past the end
+            const juce::int64 latency = settings.compensateLatency ? processor->getLatencySamples() : 0;
+            const juce::int64 renderLength = numFrames + latency;
+            juce::int64 framesToDrop = latency;
+
+            juce::AudioBuffer<float> buffer(numChannels, chunkSize);
+            juce::MidiBuffer midi;
+
+            // The processor's timeline starts with the file; each block
+            // queues the --automate points that fall inside it
+            size_t nextPoint = 0;
+
+            for (juce::int64 position = 0; position < renderLength && error.isEmpty(); position += chunkSize)
+            {
+                const int frames = (int) juce::jmin((juce::int64) chunkSize, renderLength - position);
+                const int inputFrames = (int) juce::jlimit((juce::int64) 0, (juce::int64) frames, numFrames - position);
+
+                if (inputFrames > 0 && ! reader->read(buffer, position, inputFrames))
+                {
+                    error = "read failed at frame " + juce::String(position);
+                    break;
+                }
+
+                if (inputFrames < frames)
+                    buffer.clear(inputFrames, frames - inputFrames);
+
+                // Chunks hold whole blocks, so blocks stay aligned to the file start
+                for (int offset = 0; offset < frames && error.isEmpty(); offset += blockSize)
+                {
+                    juce::AudioBuffer<float> block(buffer.getArrayOfWritePointers(), numChannels,
+                                                   offset, juce::jmin(blockSize, frames - offset));
+
+                    const juce::int64 blockEnd = position + offset + block.getNumSamples();
+
+                    for (; nextPoint < settings.automation.size(); ++nextPoint)
+                    {
+                        const auto& point = settings.automation[nextPoint];
+                        const auto at = (juce::int64) std::llround(point.seconds * sampleRate);
+
+                        if (at >= blockEnd)
+                            break;
+
+                        if (! processor->scheduleParameterChange(point.lane, at, point.value))
+                        {
+                            error = "too many --automate points within one block";
+                            break;
+                        }
+                    }
+
+                    processor->processBlock(block, midi);
+                }
+
+                const int dropped = (int) juce::jmin((juce::int64) frames, framesToDrop);
+                framesToDrop -= dropped;
+
+                if (error.isEmpty() && ! writer->writeFromAudioSampleBuffer(buffer, dropped, frames - dropped))
+                    error = "write failed (disk full?)";
+            }
+
+            writer.reset();   // flushes the header and buffer
+            reader.reset();
+
+            wallSeconds = std::chrono::duration<double>(Clock::now() - started).count();
+
+            if (error.isNotEmpty())
+                output.deleteFile();
+
+            finished.store(true, std::memory_order_release);
+        }
+
+        double getAudioSeconds() const noexcept { return error.isEmpty() && sampleRate > 0.0 ? numFrames / sampleRate : 0.0; }
+
+        bool fail(const juce::String& message)
+        {
+            error = message;
+            return false;
+        }
+
+        const juce::File input;
+        juce::File output;
+        juce::String error;
+
+        double sampleRate = 0.0, wallSeconds = 0.0;
+        juce::int64 numFrames = 0;
+
+        std::unique_ptr<ChunkReader> reader;
+        std::unique_ptr<juce::AudioFormatWriter> writer;
+        std::unique_ptr<EnzoGainAudioProcessor> processor;   // released on the main thread once finished
+        std::atomic<bool> finished { false };
+    };
+
+    // ── Report ───────────────────────────────────────────────────────
+
+    void report(const std::vector<std::unique_ptr<FileJob>>& jobs, double wallSeconds, int numJobs, bool json)
+    {
+        double audioSeconds = 0.0;
+
+        for (const auto& job : jobs)
+            audioSeconds += job->getAudioSeconds();
+
+        const double realtime = wallSeconds > 0.0 ? audioSeconds / wallSeconds : 0.0;
+
+        if (json)
+        {
+            juce::Array<juce::var> files;
+
+            for (const auto& job : jobs)
+            {
+                juce::DynamicObject::Ptr file = new juce::DynamicObject();
+                file->setProperty("input", job->input.getFullPathName());
+                file->setProperty("output", job->error.isEmpty() ? juce::var(job->output.getFullPathName()) : juce::var());
+                file->setProperty("audio_seconds", job->getAudioSeconds());
+                file->setProperty("wall_seconds", job->wallSeconds);
+                file->setProperty("realtime", job->wallSeconds > 0.0 ? job->getAudioSeconds() / job->wallSeconds : 0.0);
+
+                if (job->error.isNotEmpty())
+                    file->setProperty("error", job->error);
+
+                files.add(juce::var(file.get()));
+            }
+
+            juce::DynamicObject::Ptr result = new juce::DynamicObject();
+            result->setProperty("files", files);
+            result->setProperty("jobs", numJobs);
+            result->setProperty("audio_seconds", audioSeconds);
+            result->setProperty("wall_seconds", wallSeconds);
+            result->setProperty("realtime", realtime);
+
+            std::cout << juce::JSON::toString(juce::var(result.get())) << '\n';
+            return;
+        }
+
+        for (const auto& job : jobs)
+        {
+            if (job->error.isNotEmpty())
+                std::cout << job->input.getFileName() << ": " << job->error << '\n';
+            else
+                std::cout << job->input.getFileName() << ": " << job->getAudioSeconds() << " s in "
+                          << job->wallSeconds << " s, " << job->getAudioSeconds() / juce::jmax(1.0e-9, job->wallSeconds)
+                          << "x realtime\n";
+        }
+
+        std::cout << "total: " << audioSeconds << " s of audio in " << wallSeconds << " s, "
+                  << realtime << "x realtime (" << numJobs << " jobs)\n";
+    }
+
+    void addInputs(const juce::File& path, std::vector<juce::File>& inputs)
+    {
+        if (! path.isDirectory())
+        {
+            inputs.push_back(path);
+            return;
+        }
+
+        std::vector<juce::File> found;
+
+        for (const auto& entry : juce::RangedDirectoryIterator(path, false, "*", juce::File::findFiles))
+            if (supportedExtensions.contains(entry.getFile().getFileExtension().substring(1), true))
+                found.push_back(entry.getFile());
+
+        std::sort(found.begin(), found.end());
+        inputs.insert(inputs.end(), found.begin(), found.end());
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    Settings settings;
+    int numJobs = juce::jmax(1, juce::SystemStats::getNumCpus());
+    bool json = false;
+
+    juce::File stateFile;
+    juce::StringArray assignments, automation;
+    std::vector<juce::File> inputs;
+
+    const auto usage = [&argv]
+    {
+        std::cerr << "usage: " << argv[0] << " [--state file] [--set ID=value]... [--automate ID=value@seconds]...\n"
+                     "       [--block n] [--jobs n]\n"
+                     "       [--format wav|aiff|flac] [--bits 16|24|32] [--compensate-latency] [--overwrite] [--json]\n"
+                     "       -o <dir> <file or directory>...\n";
+        return 1;
+    };
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const juce::String arg(argv[i]);
+        const bool hasValue = i + 1 < argc;
+
+        if (arg == "--json")                                json = true;
+        else if (arg == "--compensate-latency")             settings.compensateLatency = true;
+        else if (arg == "--overwrite")                      settings.overwrite = true;
+        else if ((arg == "-o" || arg == "--out") && hasValue)
+            settings.outputDirectory = juce::File::getCurrentWorkingDirectory().getChildFile(argv[++i]);
+        else if (arg == "--state" && hasValue)
+            stateFile = juce::File::getCurrentWorkingDirectory().getChildFile(argv[++i]);
+        else if (arg == "--set" && hasValue)                assignments.add(argv[++i]);
+        else if (arg == "--automate" && hasValue)           automation.add(argv[++i]);
+        else if (arg == "--block" && hasValue)              settings.blockSize = juce::jlimit(1, 65536, std::atoi(argv[++i]));
+        else if (arg == "--jobs" && hasValue)               numJobs = juce::jmax(1, std::atoi(argv[++i]));
+        else if (arg == "--bits" && hasValue)               settings.bitsPerSample = juce::jlimit(8, 32, std::atoi(argv[++i]));
+        else if (arg == "--format" && hasValue && supportedExtensions.contains(argv[i + 1], true))
+            settings.format = juce::String(argv[++i]).toLowerCase();
+        else if (! arg.startsWith("-"))
+            addInputs(juce::File::getCurrentWorkingDirectory().getChildFile(arg), inputs);
+        else
+            return usage();
+    }
+
+    if (inputs.empty() || settings.outputDirectory == juce::File())
+        return usage();
+
+    if (const auto created = settings.outputDirectory.createDirectory(); created.failed())
+    {
+        std::cerr << created.getErrorMessage() << '\n';
+        return 1;
+    }
+
+    // ── The state every file gets: --state, then each --set ──────────────
+    {
+        EnzoGainAudioProcessor preset;
+        juce::String error;
+
+        if (stateFile != juce::File() && ! loadState(preset, stateFile, error))
+        {
+            std::cerr << error << '\n';
+            return 1;
+        }
+
+        for (const auto& assignment : assignments)
+        {
+            if (! setParameter(preset, assignment, error))
+            {
+                std::cerr << error << '\n';
+                return 1;
+            }
+        }
+
+        preset.getStateInformation(settings.state);
+
+        for (const auto& text : automation)
+        {
+            AutomationPoint point;
+
+            if (! parseAutomationPoint(preset, text, point, error))
+            {
+                std::cerr << error << '\n';
+                return 1;
+            }
+
+            settings.automation.push_back(point);
+        }
+
+        // Points at the same time keep their command-line order
+        std::stable_sort(settings.automation.begin(), settings.automation.end(),
+                         [](const auto& a, const auto& b) { return a.seconds < b.seconds; });
+    }
+
+    // ── Files: opened here, processed on the pool ────────────────────────
+    juce::AudioFormatManager formats;
+    formats.registerBasicFormats();
+
+    juce::ThreadPool pool(numJobs);
+    juce::WaitableEvent jobFinished;
+    std::atomic<int> numRunning { 0 };
+    std::vector<std::unique_ptr<FileJob>> jobs;
+
+    const auto releaseFinished = [&jobs]
+    {
+        for (auto& job : jobs)
+            if (job->processor != nullptr && job->finished.load(std::memory_order_acquire))
+                job->processor.reset();
+    };
+
+    // Two inputs of the same name would write the same output: the first
+    // claims it.  Settled before any job starts, never from a job's state,
+    // which the pool may be writing
+    std::map<juce::File, size_t> outputOwners;   // output → index into inputs
+
+    for (size_t i = 0; i < inputs.size(); ++i)
+        outputOwners.emplace(getOutputFile(inputs[i], settings), i);
+
+    const auto started = Clock::now();
+
+    for (size_t index = 0; index < inputs.size(); ++index)
+    {
+        const auto& input = inputs[index];
+        jobs.push_back(std::make_unique<FileJob>(input));
+        auto& job = *jobs.back();
+
+        const size_t owner = outputOwners.at(getOutputFile(input, settings));
+
+        if (owner != index)
+            job.fail("same output file as " + inputs[owner].getFullPathName());
+
+        if (job.error.isNotEmpty() || ! job.open(formats, settings))
+        {
+            job.processor.reset();
+            continue;
+        }
+
+        while (numRunning.load() >= numJobs)
+        {
+            jobFinished.wait(100);
+            releaseFinished();
+        }
+
+        ++numRunning;
+
+        pool.addJob([&job, &settings, &numRunning, &jobFinished]
+        {
+            job.run(settings);
+            --numRunning;
+            jobFinished.signal();
+        });
+    }
+
+    while (numRunning.load() > 0)
+        jobFinished.wait(100);
+
+    releaseFinished();
+
+    const double wallSeconds = std::chrono::duration<double>(Clock::now() - started).count();
+    report(jobs, wallSeconds, numJobs, json);
+
+    return std::any_of(jobs.begin(), jobs.end(), [](const auto& job) { return job->error.isNotEmpty(); }) ? 1 : 0;
+}
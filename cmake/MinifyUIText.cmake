@@ -0,0 +1,72 @@
+# Conservative minifier for the embedded UI's HTML / JS / CSS text.
+#
+#   cmake -DINPUT=<file> -DOUTPUT=<file> -P MinifyUIText.cmake
+#
+# Line-based, so nothing the browser parses changes meaning: strips
+# indentation, blank lines, whole-line // comments, block comments that
+# occupy whole lines and single-line HTML comments.  Line breaks stay, so
+# JavaScript's automatic semicolon insertion is unaffected.
+
+if(NOT INPUT OR NOT OUTPUT)
+    message(FATAL_ERROR "MinifyUIText: pass -DINPUT=<file> -DOUTPUT=<file>")
+endif()
+
+file(READ "${INPUT}" text)
+
+# Stand-ins for the characters that would split or nest CMake list items
+string(ASCII 1 semicolonMark)
+string(ASCII 2 openBracketMark)
+string(ASCII 3 closeBracketMark)
+string(ASCII 4 backslashMark)
+
+string(REPLACE "\\" "${backslashMark}" text "${text}")
+string(REPLACE ";" "${semicolonMark}" text "${text}")
+string(REPLACE "[" "${openBracketMark}" text "${text}")
+string(REPLACE "]" "${closeBracketMark}" text "${text}")
+string(REPLACE "\r" "" text "${text}")
+string(REPLACE "\n" ";" lines "${text}")
+
+set(minified "")
+set(inBlockComment OFF)
+
+foreach(line IN LISTS lines)
+    string(STRIP "${line}" line)
+
+    if(inBlockComment)
+        if(line MATCHES "\\*/$")
+            set(inBlockComment OFF)
+        elseif(line MATCHES "\\*/")
+            # Code after the comment on its closing line: keep the line
+            set(inBlockComment OFF)
+            string(APPEND minified "${line}\n")
+        endif()
+        continue()
+    endif()
+
+    if(line STREQUAL "" OR line MATCHES "^//" OR line MATCHES "^<!--.*-->$")
+        continue()
+    endif()
+
+    if(line MATCHES "^/\\*")
+        if(line MATCHES "\\*/$")
+            continue()
+        elseif(NOT line MATCHES "\\*/")
+            set(inBlockComment ON)
+            continue()
+        endif()
+    endif()
+
+    string(APPEND minified "${line}\n")
+endforeach()
+
+string(REPLACE "${semicolonMark}" ";" minified "${minified}")
+string(REPLACE "${openBracketMark}" "[" minified "${minified}")
+string(REPLACE "${closeBracketMark}" "]" minified "${minified}")
+string(REPLACE "${backslashMark}" "\\" minified "${minified}")
+
+file(WRITE "${OUTPUT}" "${minified}")
+
+file(SIZE "${INPUT}" inputSize)
+string(LENGTH "${minified}" outputSize)
+get_filename_component(name "${INPUT}" NAME)
+message(STATUS "Minified ${name}: ${inputSize} -> ${outputSize} bytes")
@@ -0,0 +1,54 @@
+# Prints the code size of every specialised DSP kernel in a linked binary.
+#
+#   cmake -DNM=<nm> -DBINARY=<file> -P ReportKernelSizes.cmake
+#
+# Needs an nm that understands --print-size (GNU binutils or llvm-nm).
+
+if(NOT NM OR NOT BINARY)
+    message(FATAL_ERROR "ReportKernelSizes: pass -DNM=<nm> -DBINARY=<file>")
+endif()
+
+execute_process(
+    COMMAND "${NM}" --demangle --print-size --size-sort "${BINARY}"
+    OUTPUT_VARIABLE symbols
+    RESULT_VARIABLE result
+)
+
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "ReportKernelSizes: ${NM} failed on ${BINARY}")
+endif()
+
+string(REPLACE "\n" ";" lines "${symbols}")
+
+set(kernelPatterns
+    "EnzoGainAudioProcessor::processChunk<"
+    "EnzoGainAudioProcessor::shapeWet<"
+    "EnzoGainDSP::Waveshaper::process<"
+)
+
+set(total 0)
+set(count 0)
+
+foreach(line IN LISTS lines)
+    # <address> <size> <type> <name>
+    if(NOT line MATCHES "^[0-9a-fA-F]+ ([0-9a-fA-F]+) [tTwW] (.*)$")
+        continue()
+    endif()
+
+    set(sizeHex "${CMAKE_MATCH_1}")
+    set(name "${CMAKE_MATCH_2}")
+
+    foreach(pattern IN LISTS kernelPatterns)
+        string(FIND "${name}" "${pattern}" found)
+
+        if(NOT found EQUAL -1)
+            math(EXPR size "0x${sizeHex}")
+            math(EXPR total "${total} + ${size}")
+            math(EXPR count "${count} + 1")
+            message(STATUS "${size}\t${name}")
+            break()
+        endif()
+    endforeach()
+endforeach()
+
+message(STATUS "${count} kernel instantiations, ${total} bytes in total")